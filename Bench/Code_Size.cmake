@@ -0,0 +1,30 @@
+# Print the code size of every API of a driver library:
+#   cmake -DNM=<nm> -DLIBRARY=<library> -DPREFIX=<API prefix> -P Code_Size.cmake
+if(NOT NM OR NOT LIBRARY OR NOT PREFIX)
+	message(FATAL_ERROR "Code_Size.cmake needs NM, LIBRARY and PREFIX")
+endif()
+
+execute_process(
+	COMMAND ${NM} --print-size --size-sort --defined-only ${LIBRARY}
+	OUTPUT_VARIABLE symbols
+	RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+	message(FATAL_ERROR "${NM} failed on ${LIBRARY}")
+endif()
+
+get_filename_component(name ${LIBRARY} NAME)
+message("Code size of ${name}:")
+string(REPLACE "\n" ";" symbols "${symbols}")
+foreach(line IN LISTS symbols)
+	# <address> <size> <type> <symbol>
+	if(line MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tT] (${PREFIX}[A-Za-z0-9_]*)$")
+		math(EXPR size "0x${CMAKE_MATCH_1}" OUTPUT_FORMAT DECIMAL)
+		string(LENGTH "${CMAKE_MATCH_2}" length)
+		math(EXPR padding "28 - ${length}")
+		if(padding LESS 1)
+			set(padding 1)
+		endif()
+		string(REPEAT " " ${padding} spaces)
+		message("  ${CMAKE_MATCH_2}${spaces}${size} bytes")
+	endif()
+endforeach()
@@ -0,0 +1,206 @@
+ /******************************************************************************
+ *
+ * Module: Bench
+ *
+ * File Name: Dio_Bench.c
+ *
+ * Description: Microbenchmark of the Dio hot paths (Dio_WriteChannel, Dio_ReadChannel
+ *              and Dio_FlipChannel).
+ *              - Host build (REG_ACCESS_HOST_SIM): runs over the simulated registers and
+ *                reports ns/call and register accesses per call.
+ *              - Target build (REG_ACCESS_MMIO): Dio_Bench_Run() times every API with
+ *                SysTick and stores the cycles per call in Dio_Bench_Cycles[].
+ *              The cost of an empty call through the same function pointer is measured
+ *              as reference, so it can be subtracted from the other results.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L   /* clock_gettime() */
+#endif
+
+#include "Dio.h"
+#include "Reg_Access.h"
+
+/* Default number of calls of every API per measurement */
+#ifndef DIO_BENCH_ITERATIONS
+#if (REG_ACCESS_BACKEND == REG_ACCESS_HOST_SIM)
+#define DIO_BENCH_ITERATIONS               (1000000UL)
+#else
+/* SysTick is a 24-bit counter: the whole measurement shall take less than 2^24 cycles */
+#define DIO_BENCH_ITERATIONS               (1000UL)
+#endif
+#endif
+
+/* API under measurement */
+typedef void (*Dio_Bench_ApiType)(void);
+
+typedef struct
+{
+	const char * Name;
+	Dio_Bench_ApiType Api;
+} Dio_Bench_CaseType;
+
+/* Level written by Dio_WriteChannel, toggled by every call so both paths are measured */
+STATIC Dio_LevelType Dio_Bench_Level = STD_LOW;
+
+STATIC void Dio_Bench_Empty(void)
+{
+}
+
+STATIC void Dio_Bench_WriteChannel(void)
+{
+	Dio_Bench_Level ^= STD_HIGH;
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, Dio_Bench_Level);
+}
+
+STATIC void Dio_Bench_ReadChannel(void)
+{
+	(void)Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+}
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+STATIC void Dio_Bench_FlipChannel(void)
+{
+	(void)Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+}
+#endif
+
+STATIC const Dio_Bench_CaseType Dio_Bench_Cases[] =
+{
+	{"(empty call)",     Dio_Bench_Empty},
+	{"Dio_WriteChannel", Dio_Bench_WriteChannel},
+	{"Dio_ReadChannel",  Dio_Bench_ReadChannel},
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+	{"Dio_FlipChannel",  Dio_Bench_FlipChannel},
+#endif
+};
+
+#define DIO_BENCH_CASES                    (sizeof(Dio_Bench_Cases) / sizeof(Dio_Bench_Cases[0]))
+
+#if (REG_ACCESS_BACKEND == REG_ACCESS_HOST_SIM)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "Port.h"
+
+STATIC uint64 Dio_Bench_NowNs(void)
+{
+	struct timespec now;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64)now.tv_sec * 1000000000ULL) + (uint64)now.tv_nsec;
+}
+
+int main(int argc, char * argv[])
+{
+	RegSim_StatsType stats;
+	unsigned long iterations = DIO_BENCH_ITERATIONS;
+	unsigned long call;
+	uint64 start;
+	uint64 elapsed;
+	uint32 index;
+
+	/* Usage: dio_bench [iterations] */
+	if (argc > 1)
+	{
+		iterations = strtoul(argv[1], NULL_PTR, 0);
+		if (0UL == iterations)
+		{
+			iterations = DIO_BENCH_ITERATIONS;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	RegSim_Reset();
+	Port_Init(&Port_Configuration);
+	Dio_Init(&Dio_Configuration);
+
+	printf("Dio benchmark: DIO_DEV_ERROR_DETECT=%s DIO_MASKED_DATA_ACCESS=%s iterations=%lu\n",
+			(DIO_DEV_ERROR_DETECT == STD_ON) ? "ON" : "OFF",
+			(DIO_MASKED_DATA_ACCESS == STD_ON) ? "ON" : "OFF", iterations);
+	printf("%-18s %10s %12s %12s %8s\n", "API", "ns/call", "reads/call", "writes/call", "faults");
+
+	for (index = 0U; index < DIO_BENCH_CASES; index++)
+	{
+		RegSim_ClearStats();
+		start = Dio_Bench_NowNs();
+		for (call = 0UL; call < iterations; call++)
+		{
+			Dio_Bench_Cases[index].Api();
+		}
+		elapsed = Dio_Bench_NowNs() - start;
+		RegSim_GetStats(&stats);
+
+		printf("%-18s %10.2f %12.2f %12.2f %8lu\n", Dio_Bench_Cases[index].Name,
+				(double)elapsed / (double)iterations,
+				(double)stats.Reads / (double)iterations,
+				(double)stats.Writes / (double)iterations,
+				(unsigned long)stats.Faults);
+	}
+	return 0;
+}
+
+#else /* REG_ACCESS_BACKEND == REG_ACCESS_MMIO */
+
+#include "tm4c123gh6pm_registers.h"
+
+/* SysTick: enable with the core clock as source, no interrupt */
+#define DIO_BENCH_SYSTICK_ENABLE           (0x00000005UL)
+#define DIO_BENCH_SYSTICK_MAX              (0x00FFFFFFUL)
+
+/* Core clock cycles per call of every case, to be inspected with the debugger */
+volatile uint32 Dio_Bench_Cycles[DIO_BENCH_CASES];
+
+/************************************************************************************
+* Service Name: Dio_Bench_Run
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to time the Dio hot paths with SysTick on the target, the Port
+*              and Dio drivers shall be initialized and SysTick shall not be in use.
+************************************************************************************/
+void Dio_Bench_Run(void)
+{
+	uint32 index;
+	uint32 call;
+	uint32 start;
+	uint32 end;
+
+	REG_WRITE32(&SYSTICK_CTRL_REG, 0U);
+	REG_WRITE32(&SYSTICK_RELOAD_REG, DIO_BENCH_SYSTICK_MAX);
+
+	for (index = 0U; index < DIO_BENCH_CASES; index++)
+	{
+		/* Restart the counter from its reload value for every case */
+		REG_WRITE32(&SYSTICK_CURRENT_REG, 0U);
+		REG_WRITE32(&SYSTICK_CTRL_REG, DIO_BENCH_SYSTICK_ENABLE);
+
+		start = REG_READ32(&SYSTICK_CURRENT_REG);
+		for (call = 0U; call < DIO_BENCH_ITERATIONS; call++)
+		{
+			Dio_Bench_Cases[index].Api();
+		}
+		end = REG_READ32(&SYSTICK_CURRENT_REG);
+
+		REG_WRITE32(&SYSTICK_CTRL_REG, 0U);
+
+		/* SysTick counts down */
+		Dio_Bench_Cycles[index] = ((start - end) & DIO_BENCH_SYSTICK_MAX) / DIO_BENCH_ITERATIONS;
+	}
+}
+
+#endif
@@ -0,0 +1,284 @@
+ /******************************************************************************
+ *
+ * Module: Bench
+ *
+ * File Name: Driver_Bench.c
+ *
+ * Description: Host benchmark of the Port and Dio drivers over the simulated registers,
+ *              it reports the number of register accesses of every API call.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "Port.h"
+#include "Dio.h"
+#include "Reg_Sim.h"
+
+#if ((PORT_TRACE_API == STD_ON) || (DIO_TRACE_API == STD_ON))
+#include "Trace.h"
+#include "Reg_Access.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* SysTick: enable with the core clock as source, no interrupt */
+#define BENCH_SYSTICK_ENABLE           (0x00000005UL)
+#define BENCH_SYSTICK_MAX              (0x00FFFFFFUL)
+#endif
+
+/* API under measurement */
+typedef void (*Bench_ApiType)(void);
+
+typedef struct
+{
+	const char * Name;
+	Bench_ApiType Api;
+} Bench_CaseType;
+
+STATIC void Bench_PortInit(void)
+{
+	Port_Init(&Port_Configuration);
+}
+
+STATIC void Bench_PortRefreshPortDirection(void)
+{
+	Port_RefreshPortDirection();
+}
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+STATIC void Bench_PortSetPinDirection(void)
+{
+	Port_SetPinDirection(PORT_PIN_29, PORT_PIN_OUT);
+}
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+STATIC void Bench_PortSetPinMode(void)
+{
+	Port_SetPinMode(PORT_PIN_29, PORT_PIN_MODE_DIO);
+}
+#endif
+
+#if (PORT_SET_PINS_CONFIG_API == STD_ON)
+/*
+ * Round trip of LED1 (PF1), the pin of the per-pin cases: input, then output again through the
+ * path of the new outputs. SW1 (PF4) keeps its configuration for the Dio cases
+ */
+STATIC const Port_PinConfigType Bench_PinsInput[] =
+{
+	{PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_IN}
+};
+
+STATIC const Port_PinConfigType Bench_PinsOutput[] =
+{
+	{PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_OUT}
+};
+
+STATIC void Bench_PortSetPinsConfig(void)
+{
+	(void)Port_SetPinsConfig(Bench_PinsInput, 1U);
+	(void)Port_SetPinsConfig(Bench_PinsOutput, 1U);
+}
+#endif
+
+#if (PORT_PROFILES_API == STD_ON)
+/* Round trip run -> low power -> run, the cost of two switches */
+STATIC void Bench_PortSwitchProfile(void)
+{
+	Port_SwitchProfile(PORT_PROFILE_LOW_POWER);
+	Port_SwitchProfile(PORT_PROFILE_RUN);
+}
+#endif
+
+#if (PORT_LOW_POWER_API == STD_ON)
+/* Sleep and wake up, the cost of the two services */
+STATIC void Bench_PortLowPower(void)
+{
+	Port_EnterLowPower();
+	Port_ExitLowPower();
+}
+#endif
+
+#if (PORT_SCRUB_API == STD_ON)
+STATIC void Bench_PortScrubRegisters(void)
+{
+	Port_ScrubRegisters();
+}
+#endif
+
+STATIC void Bench_DioWriteChannel(void)
+{
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+}
+
+STATIC void Bench_DioReadChannel(void)
+{
+	(void)Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+}
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+STATIC void Bench_DioFlipChannel(void)
+{
+	(void)Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+}
+#endif
+
+#if (DIO_INLINE_API == STD_ON)
+STATIC void Bench_DioWriteChannelInline(void)
+{
+	DIO_WRITE_CHANNEL_INLINE(DioConf_LED1, STD_HIGH);
+}
+
+STATIC void Bench_DioReadChannelInline(void)
+{
+	(void)DIO_READ_CHANNEL_INLINE(DioConf_SW1);
+}
+
+STATIC void Bench_DioFlipChannelInline(void)
+{
+	DIO_FLIP_CHANNEL_INLINE(DioConf_LED1);
+}
+#endif
+
+STATIC void Bench_DioWritePort(void)
+{
+	Dio_WritePort(DioConf_PORTF_PORT_ID_INDEX, 0x02U);
+}
+
+STATIC void Bench_DioReadPort(void)
+{
+	(void)Dio_ReadPort(DioConf_PORTF_PORT_ID_INDEX);
+}
+
+STATIC void Bench_DioWriteChannelGroup(void)
+{
+	Dio_WriteChannelGroup(DioConf_RGB_LED_GROUP, 0x05U);
+}
+
+STATIC void Bench_DioReadChannelGroup(void)
+{
+	(void)Dio_ReadChannelGroup(DioConf_RGB_LED_GROUP);
+}
+
+#if (DIO_EDGE_CAPTURE_API == STD_ON)
+STATIC void Bench_DioEdgeIsr(void)
+{
+	Dio_EdgeEventType event;
+
+	/* SW1 pressed: one falling edge pending on PORTF, drained by the interrupt and read by the task */
+	RegSim_SetPinLevel(DioConf_SW1_PORT_NUM, DioConf_SW1_CHANNEL_NUM, STD_HIGH);
+	RegSim_SetPinLevel(DioConf_SW1_PORT_NUM, DioConf_SW1_CHANNEL_NUM, STD_LOW);
+	Dio_EdgeIsr(DioConf_SW1_PORT_NUM);
+	(void)Dio_GetEdgeEvent(&event);
+}
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+STATIC void Bench_DioDebounceMainFunction(void)
+{
+	Dio_DebounceMainFunction();
+}
+#endif
+
+#if (DIO_SOFT_PWM_API == STD_ON)
+STATIC void Bench_DioSoftPwmIsr(void)
+{
+	/* LED1 at 25 %: the first call starts the period with the new schedule */
+	Dio_SoftPwmSetDuty(DioConf_LED1_CHANNEL_ID_INDEX, DIO_SOFT_PWM_PERIOD / 4U);
+	(void)Dio_SoftPwmIsr();
+}
+#endif
+
+STATIC const Bench_CaseType Bench_Cases[] =
+{
+	{"Port_Init",                 Bench_PortInit},
+	{"Port_RefreshPortDirection", Bench_PortRefreshPortDirection},
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+	{"Port_SetPinDirection",      Bench_PortSetPinDirection},
+#endif
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+	{"Port_SetPinMode",           Bench_PortSetPinMode},
+#endif
+#if (PORT_SET_PINS_CONFIG_API == STD_ON)
+	{"Port_SetPinsConfig x2",     Bench_PortSetPinsConfig},
+#endif
+#if (PORT_PROFILES_API == STD_ON)
+	{"Port_SwitchProfile x2",     Bench_PortSwitchProfile},
+#endif
+#if (PORT_LOW_POWER_API == STD_ON)
+	{"Port_Enter/ExitLowPower",   Bench_PortLowPower},
+#endif
+#if (PORT_SCRUB_API == STD_ON)
+	{"Port_ScrubRegisters",       Bench_PortScrubRegisters},
+#endif
+	{"Dio_WriteChannel",          Bench_DioWriteChannel},
+	{"Dio_ReadChannel",           Bench_DioReadChannel},
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+	{"Dio_FlipChannel",           Bench_DioFlipChannel},
+#endif
+#if (DIO_INLINE_API == STD_ON)
+	{"DIO_WRITE_CHANNEL_INLINE",  Bench_DioWriteChannelInline},
+	{"DIO_READ_CHANNEL_INLINE",   Bench_DioReadChannelInline},
+	{"DIO_FLIP_CHANNEL_INLINE",   Bench_DioFlipChannelInline},
+#endif
+	{"Dio_WritePort",             Bench_DioWritePort},
+	{"Dio_ReadPort",              Bench_DioReadPort},
+	{"Dio_WriteChannelGroup",     Bench_DioWriteChannelGroup},
+	{"Dio_ReadChannelGroup",      Bench_DioReadChannelGroup},
+#if (DIO_EDGE_CAPTURE_API == STD_ON)
+	{"Dio_EdgeIsr",               Bench_DioEdgeIsr},
+#endif
+#if (DIO_DEBOUNCE_API == STD_ON)
+	{"Dio_DebounceMainFunction",  Bench_DioDebounceMainFunction},
+#endif
+#if (DIO_SOFT_PWM_API == STD_ON)
+	{"Dio_SoftPwmIsr",            Bench_DioSoftPwmIsr},
+#endif
+};
+
+int main(int argc, char * argv[])
+{
+	RegSim_StatsType stats;
+	uint32 index;
+#if ((PORT_TRACE_API == STD_ON) || (DIO_TRACE_API == STD_ON))
+	FILE * dump;
+#endif
+
+	RegSim_Reset();
+#if ((PORT_TRACE_API == STD_ON) || (DIO_TRACE_API == STD_ON))
+	/* run SysTick for the time stamps of the records (one tick per simulated bus access) */
+	REG_WRITE32(&SYSTICK_RELOAD_REG, BENCH_SYSTICK_MAX);
+	REG_WRITE32(&SYSTICK_CURRENT_REG, 0U);
+	REG_WRITE32(&SYSTICK_CTRL_REG, BENCH_SYSTICK_ENABLE);
+#endif
+	Port_Init(&Port_Configuration);
+	Dio_Init(&Dio_Configuration);
+
+	printf("%-28s %8s %8s %8s\n", "API", "reads", "writes", "faults");
+	for (index = 0U; index < (sizeof(Bench_Cases) / sizeof(Bench_Cases[0])); index++)
+	{
+		RegSim_ClearStats();
+		Bench_Cases[index].Api();
+		RegSim_GetStats(&stats);
+		printf("%-28s %8lu %8lu %8lu\n", Bench_Cases[index].Name,
+				(unsigned long)stats.Reads, (unsigned long)stats.Writes, (unsigned long)stats.Faults);
+	}
+
+#if ((PORT_TRACE_API == STD_ON) || (DIO_TRACE_API == STD_ON))
+	/* dump the trace log as the debugger would save it from the RAM of the target */
+	if (argc > 1)
+	{
+		dump = fopen(argv[1], "wb");
+		if ((NULL == dump) || (fwrite(&Trace_Log, sizeof(Trace_Log), 1U, dump) != 1U))
+		{
+			perror(argv[1]);
+			return 1;
+		}
+		(void)fclose(dump);
+	}
+#else
+	(void)argc;
+	(void)argv;
+#endif
+	return 0;
+}
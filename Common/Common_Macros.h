@@ -34,4 +34,15 @@
 /* Check if a specific bit is cleared in any register and return true if yes */
 #define BIT_IS_CLEAR(REG,BIT) ( !(REG & (1<<BIT)) )
 
+
+/* Index of the lowest set bit of a non zero 32-bit value (count trailing zeros, RBIT + CLZ on Cortex-M4) */
+#if defined(__GNUC__)
+#define LOWEST_SET_BIT(VAL) ((uint8)__builtin_ctz((uint32)(VAL)))
+#elif defined(__ICCARM__)
+#include <intrinsics.h>
+#define LOWEST_SET_BIT(VAL) ((uint8)__CLZ(__RBIT((uint32)(VAL))))
+#else
+#error "LOWEST_SET_BIT is not defined for this compiler"
+#endif
+
 #endif
@@ -50,4 +50,36 @@
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC            static
 
+/*
+ * Compile time assertion for the configuration checks: COND is an integer constant expression,
+ * the build fails on the array of negative size static_assert_NAME if it is false
+ */
+#define STATIC_ASSERT(COND, NAME)   typedef char static_assert_##NAME[(COND) ? 1 : -1]
+
+/*
+ * Compiler memory barrier: the compiler does not move memory accesses across it,
+ * used to publish data to an interrupt before the index which makes it visible
+ */
+#if defined(__GNUC__) || defined(__ICCARM__)
+#define COMPILER_BARRIER()    __asm volatile ("" ::: "memory")
+#else
+#error "COMPILER_BARRIER is not defined for this compiler"
+#endif
+
+/*
+ * Short critical sections shared by the tasks and the interrupts: save PRIMASK in STATE (uint32)
+ * and mask the interrupts, then restore the saved PRIMASK. The host builds have no interrupts.
+ */
+#if defined(__ICCARM__)
+#include <intrinsics.h>
+#define INTERRUPTS_SAVE_DISABLE(STATE)  do { (STATE) = __get_PRIMASK(); __disable_interrupt(); } while(0)
+#define INTERRUPTS_RESTORE(STATE)       __set_PRIMASK(STATE)
+#elif defined(__GNUC__) && defined(__arm__)
+#define INTERRUPTS_SAVE_DISABLE(STATE)  __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (STATE) :: "memory")
+#define INTERRUPTS_RESTORE(STATE)       __asm volatile ("msr primask, %0" :: "r" (STATE) : "memory")
+#else
+#define INTERRUPTS_SAVE_DISABLE(STATE)  ((void)(STATE))
+#define INTERRUPTS_RESTORE(STATE)       ((void)(STATE))
+#endif
+
 #endif
@@ -0,0 +1,140 @@
+ /******************************************************************************
+ *
+ * Module: Common - Register Access
+ *
+ * File Name: Reg_Access.h
+ *
+ * Description: Register access abstraction for TM4C123GH6PM Microcontroller,
+ *              every driver access to a peripheral register goes through these macros
+ *              so the same driver code runs on the target (memory mapped accesses)
+ *              or on a host machine (simulated register file).
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#ifndef REG_ACCESS_H
+#define REG_ACCESS_H
+
+#include <stdint.h>
+#include "Std_Types.h"
+
+/*
+ * Register access backends
+ */
+#define REG_ACCESS_MMIO                  (0U)   /* Volatile accesses to the physical addresses */
+#define REG_ACCESS_HOST_SIM              (1U)   /* Accesses to the in-process simulated register file */
+
+/* The backend is selected by the build, the default is the memory mapped one of the target */
+#ifndef REG_ACCESS_BACKEND
+#define REG_ACCESS_BACKEND               (REG_ACCESS_MMIO)
+#endif
+
+#if (REG_ACCESS_BACKEND == REG_ACCESS_HOST_SIM)
+
+/* Host simulation of the MCU registers */
+#include "Reg_Sim.h"
+
+/* Read a 32-bit register */
+#define REG_READ32(REG_PTR)              RegSim_Read32(REG_PTR)
+
+/* Write a 32-bit register */
+#define REG_WRITE32(REG_PTR,VALUE)       RegSim_Write32((REG_PTR),(uint32)(VALUE))
+
+/* Exclusive read / write of a 32-bit register (simulated exclusive monitor), the write returns 0 if it is done */
+#define REG_READ_EXCLUSIVE32(REG_PTR)         RegSim_ReadExclusive32(REG_PTR)
+#define REG_WRITE_EXCLUSIVE32(REG_PTR,VALUE)  RegSim_WriteExclusive32((REG_PTR),(uint32)(VALUE))
+
+#elif (REG_ACCESS_BACKEND == REG_ACCESS_MMIO)
+
+/* Read a 32-bit register */
+#define REG_READ32(REG_PTR)              (*(REG_PTR))
+
+/* Write a 32-bit register */
+#define REG_WRITE32(REG_PTR,VALUE)       (*(REG_PTR) = (uint32)(VALUE))
+
+/*
+ * Exclusive read / write of a 32-bit register (LDREX / STREX), the write returns 0 if it is done.
+ * The Cortex-M4 clears its exclusive monitor on every exception entry and return, so the write
+ * fails if an interrupt ran since the exclusive read
+ */
+#if defined(__ICCARM__)
+#include <intrinsics.h>
+#define REG_READ_EXCLUSIVE32(REG_PTR)         ((uint32)__LDREX((unsigned long *)(REG_PTR)))
+#define REG_WRITE_EXCLUSIVE32(REG_PTR,VALUE)  ((uint32)__STREX((unsigned long)(VALUE), (unsigned long *)(REG_PTR)))
+#elif defined(__GNUC__) && defined(__arm__)
+LOCAL_INLINE uint32 Reg_ReadExclusive32(const volatile uint32 * Reg)
+{
+	uint32 value;
+	__asm volatile ("ldrex %0, [%1]" : "=r" (value) : "r" (Reg) : "memory");
+	return value;
+}
+LOCAL_INLINE uint32 Reg_WriteExclusive32(volatile uint32 * Reg, uint32 Value)
+{
+	uint32 status;
+	__asm volatile ("strex %0, %2, [%1]" : "=&r" (status) : "r" (Reg), "r" (Value) : "memory");
+	return status;
+}
+#define REG_READ_EXCLUSIVE32(REG_PTR)         Reg_ReadExclusive32(REG_PTR)
+#define REG_WRITE_EXCLUSIVE32(REG_PTR,VALUE)  Reg_WriteExclusive32((REG_PTR),(uint32)(VALUE))
+#else
+/* No exclusive monitor (compile checks of the target code on a host): plain accesses, the write is always done */
+#define REG_READ_EXCLUSIVE32(REG_PTR)         REG_READ32(REG_PTR)
+#define REG_WRITE_EXCLUSIVE32(REG_PTR,VALUE)  (REG_WRITE32((REG_PTR),(VALUE)), 0U)
+#endif
+
+#else
+#error "REG_ACCESS_BACKEND shall be REG_ACCESS_MMIO or REG_ACCESS_HOST_SIM"
+#endif
+
+/* Conversions between a register pointer and its physical address (the host pointers hold the physical addresses too) */
+#define REG_POINTER_TO_ADDRESS(REG_PTR)  ((uint32)(uintptr_t)(REG_PTR))
+#define REG_ADDRESS_TO_POINTER(ADDRESS)  ((volatile uint32 *)(uintptr_t)(ADDRESS))
+
+/* Pointer to the register at the given offset (in bytes) from a registers base address */
+#define REG_ADDRESS(BASE,OFFSET)         ((volatile uint32 *)((volatile uint8 *)(BASE) + (OFFSET)))
+
+/* Set the bits of the mask in a register (read-modify-write) */
+#define REG_SET_BITS(REG_PTR,MASK)       REG_WRITE32((REG_PTR), REG_READ32(REG_PTR) | (uint32)(MASK))
+
+/* Clear the bits of the mask in a register (read-modify-write) */
+#define REG_CLEAR_BITS(REG_PTR,MASK)     REG_WRITE32((REG_PTR), REG_READ32(REG_PTR) & ~(uint32)(MASK))
+
+/* Set a certain bit in a register (read-modify-write) */
+#define REG_SET_BIT(REG_PTR,BIT)         REG_SET_BITS((REG_PTR), (uint32)1U << (BIT))
+
+/* Clear a certain bit in a register (read-modify-write) */
+#define REG_CLEAR_BIT(REG_PTR,BIT)       REG_CLEAR_BITS((REG_PTR), (uint32)1U << (BIT))
+
+/*
+ * Replace the bits of the mask in a register with those of VALUE without losing a concurrent update:
+ * the read-modify-write is repeated until its exclusive write is done, the interrupts are not masked
+ */
+#define REG_UPDATE_FIELD32(REG_PTR,MASK,VALUE) \
+	do { \
+		uint32 reg_field_value_; \
+		do { \
+			reg_field_value_ = (REG_READ_EXCLUSIVE32(REG_PTR) & ~(uint32)(MASK)) | ((uint32)(VALUE) & (uint32)(MASK)); \
+		} while (REG_WRITE_EXCLUSIVE32((REG_PTR), reg_field_value_) != 0U); \
+	} while (0)
+
+/*
+ * Bit-band alias of the peripherals (Cortex-M4): every bit of the registers in 0x40000000 - 0x400FFFFF
+ * is the bit 0 of a word in 0x42000000 - 0x43FFFFFF, a write of this word is one atomic
+ * read-modify-write of the register done by the bus, so it is safe against the interrupts
+ */
+#define REG_BITBAND_PERIPH_BASE          (0x40000000UL)
+#define REG_BITBAND_ALIAS_BASE           (0x42000000UL)
+
+/* Pointer to the bit-band alias word of a bit of a peripheral register */
+#define REG_BITBAND_ALIAS(REG_PTR,BIT) \
+	REG_ADDRESS_TO_POINTER(REG_BITBAND_ALIAS_BASE + \
+			((REG_POINTER_TO_ADDRESS(REG_PTR) - REG_BITBAND_PERIPH_BASE) << 5U) + ((uint32)(BIT) << 2U))
+
+/* Set / clear a certain bit of a peripheral register with one store to its bit-band alias */
+#define REG_BITBAND_SET_BIT(REG_PTR,BIT)     REG_WRITE32(REG_BITBAND_ALIAS((REG_PTR),(BIT)), 1U)
+#define REG_BITBAND_CLEAR_BIT(REG_PTR,BIT)   REG_WRITE32(REG_BITBAND_ALIAS((REG_PTR),(BIT)), 0U)
+
+/* Check if a specific bit is set in a register and return true if yes */
+#define REG_BIT_IS_SET(REG_PTR,BIT)      ((REG_READ32(REG_PTR) & ((uint32)1U << (BIT))) != 0U)
+
+#endif /* REG_ACCESS_H */
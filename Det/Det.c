@@ -0,0 +1,253 @@
+ /******************************************************************************
+ *
+ * Module: Det
+ *
+ * File Name: Det.c
+ *
+ * Description: Source file for the Default Error Tracer (Det) module
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#include "Det.h"
+
+#if ((DET_COUNTERS_SIZE & (DET_COUNTERS_SIZE - 1U)) != 0U)
+#error "DET_COUNTERS_SIZE shall be a power of 2"
+#endif
+
+/* Key of an error in the counters table: {module, service, error} packed in 32 bits */
+#define DET_KEY(MODULE_ID,API_ID,ERROR_ID) \
+	(((uint32)(MODULE_ID) << 16U) | ((uint32)(API_ID) << 8U) | (uint32)(ERROR_ID))
+
+/* First counter probed for a key, the next ones are probed in order */
+#define DET_HASH(KEY)              ((uint8)(((KEY) ^ ((KEY) >> 8U) ^ ((KEY) >> 16U)) & (DET_COUNTERS_SIZE - 1U)))
+
+/* Saturation value of the counters */
+#define DET_COUNT_MAX              (0xFFFFU)
+
+/* Counter of one distinct error, free while its Count is 0 */
+typedef struct
+{
+	uint32 Key;
+	uint16 Count;       /* Number of the reports, saturated at DET_COUNT_MAX */
+	uint16 Reported;    /* Count already reported by Det_MainFunction */
+	uint8 InstanceId;   /* Instance of the first report */
+} Det_CounterType;
+
+/* Number of the reported development errors */
+STATIC uint32 Det_ErrorsCount = 0U;
+
+/* Last reported development error */
+STATIC Det_ErrorType Det_LastError = {0U, 0U, 0U, 0U};
+
+/* Counters of the distinct errors */
+STATIC Det_CounterType Det_Counters[DET_COUNTERS_SIZE];
+
+/* First occurred distinct errors in the order of their first report */
+STATIC Det_ErrorType Det_FirstErrors[DET_FIRST_ERRORS_SIZE];
+STATIC uint8 Det_FirstErrorsCount = 0U;
+
+/************************************************************************************
+* Service Name: Det_ReportError
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ModuleId - Module Id of the calling module
+*                  InstanceId - Instance Id of the calling module
+*                  ApiId - Id of the API service in which the error is detected
+*                  ErrorId - Id of the detected development error
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - always E_OK
+* Description: Function to report a development error. The error is only counted in its
+*              counter (usually the first probed one) and logged at its first occurrence,
+*              it is reported later by Det_MainFunction. An error which finds no free counter
+*              is only counted in the total returned by Det_GetLastError.
+************************************************************************************/
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+	uint32 key = DET_KEY(ModuleId, ApiId, ErrorId);
+	uint8 index = DET_HASH(key);
+	uint8 probe;
+	boolean done = FALSE;
+	Det_CounterType * counter;
+	uint32 state = 0U;
+
+	/* the errors are reported from the tasks and from the interrupts */
+	INTERRUPTS_SAVE_DISABLE(state);
+
+	Det_LastError.ModuleId   = ModuleId;
+	Det_LastError.InstanceId = InstanceId;
+	Det_LastError.ApiId      = ApiId;
+	Det_LastError.ErrorId    = ErrorId;
+	Det_ErrorsCount++;
+
+	for (probe = 0U; (FALSE == done) && (probe < DET_COUNTERS_SIZE); probe++)
+	{
+		counter = &Det_Counters[(index + probe) & (DET_COUNTERS_SIZE - 1U)];
+		if (0U == counter->Count)
+		{
+			/* First occurrence of the error: take the free counter and log it */
+			counter->Key        = key;
+			counter->InstanceId = InstanceId;
+			counter->Count      = 1U;
+			if (Det_FirstErrorsCount < DET_FIRST_ERRORS_SIZE)
+			{
+				Det_FirstErrors[Det_FirstErrorsCount] = Det_LastError;
+				Det_FirstErrorsCount++;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+			done = TRUE;
+		}
+		else if (key == counter->Key)
+		{
+			if (DET_COUNT_MAX != counter->Count)
+			{
+				counter->Count++;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+			done = TRUE;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+
+	INTERRUPTS_RESTORE(state);
+	return E_OK;
+}
+
+/************************************************************************************
+* Service Name: Det_GetLastError
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Error - Pointer to where to store the last reported error
+* Return value: uint32 - Number of the reported errors
+* Description: Function to get the number of the reported errors and the last one of them.
+************************************************************************************/
+uint32 Det_GetLastError(Det_ErrorType * Error)
+{
+	if (NULL_PTR != Error)
+	{
+		*Error = Det_LastError;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return Det_ErrorsCount;
+}
+
+/************************************************************************************
+* Service Name: Det_GetErrorCount
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ModuleId - Module Id of the error
+*                  ApiId - Id of the API service of the error
+*                  ErrorId - Id of the error
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - Number of the reports of the error (saturated at 0xFFFF)
+* Description: Function to get the number of the reports of one error.
+************************************************************************************/
+uint16 Det_GetErrorCount(uint16 ModuleId, uint8 ApiId, uint8 ErrorId)
+{
+	uint32 key = DET_KEY(ModuleId, ApiId, ErrorId);
+	uint8 index = DET_HASH(key);
+	uint8 probe;
+	uint16 count = 0U;
+	const Det_CounterType * counter;
+
+	for (probe = 0U; probe < DET_COUNTERS_SIZE; probe++)
+	{
+		counter = &Det_Counters[(index + probe) & (DET_COUNTERS_SIZE - 1U)];
+		if (0U == counter->Count)
+		{
+			/* the error would have taken this counter: it was never reported */
+			probe = DET_COUNTERS_SIZE;
+		}
+		else if (key == counter->Key)
+		{
+			count = counter->Count;
+			probe = DET_COUNTERS_SIZE;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	return count;
+}
+
+/************************************************************************************
+* Service Name: Det_GetFirstErrors
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Size - Number of the errors which fit in Errors
+* Parameters (inout): None
+* Parameters (out): Errors - Pointer to where to store the first occurred errors
+* Return value: uint8 - Number of the stored errors
+* Description: Function to get the first occurred distinct errors, oldest first.
+************************************************************************************/
+uint8 Det_GetFirstErrors(Det_ErrorType * Errors, uint8 Size)
+{
+	uint8 index;
+	uint8 count = 0U;
+
+	if (NULL_PTR != Errors)
+	{
+		count = (Det_FirstErrorsCount < Size) ? Det_FirstErrorsCount : Size;
+		for (index = 0U; index < count; index++)
+		{
+			Errors[index] = Det_FirstErrors[index];
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return count;
+}
+
+/************************************************************************************
+* Service Name: Det_MainFunction
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Background function to report, through DET_REPORT_CALLOUT, every error
+*              counted since the previous call with the number of its new reports.
+************************************************************************************/
+void Det_MainFunction(void)
+{
+	uint8 index;
+	uint16 count;
+	Det_CounterType * counter;
+
+	for (index = 0U; index < DET_COUNTERS_SIZE; index++)
+	{
+		counter = &Det_Counters[index];
+		count = counter->Count;
+		if (count != counter->Reported)
+		{
+			DET_REPORT_CALLOUT((uint16)(counter->Key >> 16U), counter->InstanceId,
+					(uint8)(counter->Key >> 8U), (uint8)counter->Key, (uint16)(count - counter->Reported));
+			counter->Reported = count;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+}
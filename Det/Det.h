@@ -0,0 +1,86 @@
+ /******************************************************************************
+ *
+ * Module: Det
+ *
+ * File Name: Det.h
+ *
+ * Description: Header file for the Default Error Tracer (Det) module, it collects
+ *              the development errors reported by the drivers. Det_ReportError only counts
+ *              the error in a compact table (and logs its first occurrence), the errors
+ *              are reported later by the background Det_MainFunction.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#ifndef DET_H
+#define DET_H
+
+/* Id for the company in the AUTOSAR, here is No company just example */
+#define DET_VENDOR_ID    (1000U)
+
+/* Det Module Id */
+#define DET_MODULE_ID    (15U)
+
+/* Det Instance Id */
+#define DET_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define DET_SW_MAJOR_VERSION           (1U)
+#define DET_SW_MINOR_VERSION           (0U)
+#define DET_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DET_AR_MAJOR_VERSION           (4U)
+#define DET_AR_MINOR_VERSION           (0U)
+#define DET_AR_PATCH_VERSION           (3U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Det Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != DET_AR_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != DET_AR_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != DET_AR_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Det Pre-Compile Configuration Header file */
+#include "Det_Cfg.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Development error reported to the Det */
+typedef struct
+{
+	uint16 ModuleId;
+	uint8 InstanceId;
+	uint8 ApiId;
+	uint8 ErrorId;
+} Det_ErrorType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function to report a development error */
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId);
+
+/* Function to get the number of the reported errors and the last one of them */
+uint32 Det_GetLastError(Det_ErrorType * Error);
+
+/* Function to get the number of the reports of one error */
+uint16 Det_GetErrorCount(uint16 ModuleId, uint8 ApiId, uint8 ErrorId);
+
+/* Function to get the first occurred distinct errors, returns their number */
+uint8 Det_GetFirstErrors(Det_ErrorType * Errors, uint8 Size);
+
+/* Background function to report the errors counted since its previous call */
+void Det_MainFunction(void);
+
+#endif /* DET_H */
@@ -0,0 +1,37 @@
+ /******************************************************************************
+ *
+ * Module: Det
+ *
+ * File Name: Det_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for the Default Error Tracer (Det) module
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#ifndef DET_CFG_H
+#define DET_CFG_H
+
+/* Number of the error counters (power of 2): one counter per distinct {module, service, error} */
+#define DET_COUNTERS_SIZE                   (16U)
+
+/* Number of the first occurred distinct errors kept in the order of their first report */
+#define DET_FIRST_ERRORS_SIZE               (8U)
+
+/*
+ * Callout of Det_MainFunction for every counter which increased since the previous call:
+ * the errors are reported here, out of the APIs which detected them (e.g. to a log or a
+ * diagnostic event). Count is the number of the new reports of the error (may be overridden by the build,
+ * or by DET_REPORT_CALLOUT_FUNCTION, the name of a function with the parameters of the callout)
+ */
+#ifdef DET_REPORT_CALLOUT_FUNCTION
+extern void DET_REPORT_CALLOUT_FUNCTION(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId, uint16 Count);
+#define DET_REPORT_CALLOUT(MODULE_ID,INSTANCE_ID,API_ID,ERROR_ID,COUNT) \
+	DET_REPORT_CALLOUT_FUNCTION((MODULE_ID), (INSTANCE_ID), (API_ID), (ERROR_ID), (COUNT))
+#endif
+
+#ifndef DET_REPORT_CALLOUT
+#define DET_REPORT_CALLOUT(MODULE_ID,INSTANCE_ID,API_ID,ERROR_ID,COUNT)
+#endif
+
+#endif /* DET_CFG_H */
@@ -11,6 +11,7 @@
 
 #include "Dio.h"
 #include "Dio_Regs.h"
+#include "Reg_Access.h"
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 
@@ -24,9 +25,129 @@
 
 #endif
 
+#if (DIO_TRACE_API == STD_ON)
+/* Trace module: records the service calls in its RAM ring buffer */
+#include "Trace.h"
+#define DIO_TRACE(SID,CHANNEL,VALUE)    Trace_Record(DIO_MODULE_ID, (SID), (uint8)(CHANNEL), (uint32)(VALUE))
+#else
+#define DIO_TRACE(SID,CHANNEL,VALUE)
+#endif
+
 STATIC const Dio_ConfigChannel * Dio_PortChannels = NULL_PTR;
+STATIC const Dio_ConfigPort * Dio_Ports = NULL_PTR;
+STATIC const Dio_ChannelGroupType * Dio_Groups = NULL_PTR;
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+#if ((DIO_EDGE_CAPTURE_API == STD_ON) || (DIO_DEBOUNCE_API == STD_ON) || (DIO_SOFT_PWM_API == STD_ON))
+/* Base address of the GPIO registers of every port */
+STATIC volatile uint32 * const Dio_PortBases[DIO_NUMBER_OF_PORTS] =
+{
+		(volatile uint32 *)GPIO_PORTA_BASE_ADDRESS,
+		(volatile uint32 *)GPIO_PORTB_BASE_ADDRESS,
+		(volatile uint32 *)GPIO_PORTC_BASE_ADDRESS,
+		(volatile uint32 *)GPIO_PORTD_BASE_ADDRESS,
+		(volatile uint32 *)GPIO_PORTE_BASE_ADDRESS,
+		(volatile uint32 *)GPIO_PORTF_BASE_ADDRESS
+};
+#endif
+
+#if (DIO_EDGE_CAPTURE_API == STD_ON)
+
+#if (((DIO_EDGE_QUEUE_SIZE & (DIO_EDGE_QUEUE_SIZE - 1U)) != 0U) || (DIO_EDGE_QUEUE_SIZE > 128U))
+#error "DIO_EDGE_QUEUE_SIZE shall be a power of 2 and not more than 128"
+#endif
+
+/* Marks a pin without a channel configured for the edge capture */
+#define DIO_EDGE_NO_CHANNEL            (uint8)0xFF
+
+/* Channel ID of every pin configured for the edge capture, filled by Dio_Init */
+STATIC uint8 Dio_EdgeChannels[DIO_NUMBER_OF_PORTS][DIO_PORT_PINS];
+
+/*
+ * Single producer / single consumer queue of the edge events: Dio_EdgeIsr is the only
+ * writer of the head and Dio_GetEdgeEvent is the only writer of the tail, so no lock is needed.
+ * The indices run freely and are masked by the queue size when the queue is accessed.
+ */
+STATIC Dio_EdgeEventType Dio_EdgeQueue[DIO_EDGE_QUEUE_SIZE];
+STATIC volatile uint8 Dio_EdgeHead = 0U;
+STATIC volatile uint8 Dio_EdgeTail = 0U;
+
+/* Number of the edge events lost as the queue was full */
+STATIC volatile uint32 Dio_EdgeOverflows = 0U;
+
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+/*
+ * Vertical counters of the debouncing, indexed by the Port ID: bit n of the two counter
+ * bytes of a port is the 2-bit counter of pin n, so the 8 pins are counted at once
+ */
+STATIC uint8 Dio_DebounceCount0[DIO_NUMBER_OF_PORTS];
+STATIC uint8 Dio_DebounceCount1[DIO_NUMBER_OF_PORTS];
+
+/* Debounced (stable) levels of the pins of every port */
+STATIC uint8 Dio_DebounceLevels[DIO_NUMBER_OF_PORTS];
+
+/* Pins of every port which are active at low level (a press drives them low) */
+STATIC uint8 Dio_DebounceActiveLow[DIO_NUMBER_OF_PORTS];
+
+/* Latched press / release events of the pins of every port, cleared when they are read */
+STATIC uint8 Dio_DebouncePressed[DIO_NUMBER_OF_PORTS];
+STATIC uint8 Dio_DebounceReleased[DIO_NUMBER_OF_PORTS];
+
+/* Ports which have configured channels, sampled by Dio_DebounceMainFunction */
+STATIC uint8 Dio_DebouncePorts[DIO_NUMBER_OF_PORTS];
+STATIC uint8 Dio_DebouncePortCount = 0U;
+
+/* Non AUTOSAR private function to start the debouncing from the current levels */
+STATIC void Dio_DebounceInit(const Dio_ConfigChannel * Channels);
+#endif
+
+#if (DIO_SOFT_PWM_API == STD_ON)
+/* Transition of the soft PWM: the pins of every port which are written at this tick of the period */
+typedef struct
+{
+	uint16 Tick;
+	uint8 Masks[DIO_NUMBER_OF_PORTS];
+} Dio_SoftPwmTransitionType;
+
+/*
+ * Schedule of one soft PWM period: the transitions sorted by tick, the first one at tick 0,
+ * the ports which have channels driven by the soft PWM and the pins set at the start of the period
+ */
+typedef struct
+{
+	Dio_SoftPwmTransitionType Transitions[DIO_CONFIGURED_CHANNLES + 1U];
+	uint8 Count;
+	uint8 Ports[DIO_NUMBER_OF_PORTS];
+	uint8 PortCount;
+	uint8 Set[DIO_NUMBER_OF_PORTS];
+} Dio_SoftPwmScheduleType;
+
+/* Duty cycle of every channel in timer ticks, DIO_SOFT_PWM_OFF if the channel is not driven */
+STATIC uint16 Dio_SoftPwmDuty[DIO_CONFIGURED_CHANNLES];
+
+/*
+ * Two schedules: the interrupt runs the active one while Dio_SoftPwmSetDuty builds the other one,
+ * the interrupt switches to it at the start of the next period when it is pending
+ */
+STATIC Dio_SoftPwmScheduleType Dio_SoftPwmSchedules[2];
+STATIC volatile uint8 Dio_SoftPwmActive = 0U;
+STATIC volatile boolean Dio_SoftPwmPending = FALSE;
+
+/* Next transition applied by Dio_SoftPwmIsr */
+STATIC uint8 Dio_SoftPwmNext = 0U;
+
+/* Non AUTOSAR private functions to build the schedule of the soft PWM */
+STATIC void Dio_SoftPwmBuild(Dio_SoftPwmScheduleType * Schedule);
+STATIC void Dio_SoftPwmInsert(Dio_SoftPwmScheduleType * Schedule, uint8 Index, uint16 Tick);
+#endif
+
+#if (DIO_EDGE_CAPTURE_API == STD_ON)
+/* Non AUTOSAR private function to configure the GPIO interrupts of the edge capture */
+STATIC void Dio_EdgeInit(const Dio_ConfigChannel * Channels);
+#endif
+
 /************************************************************************************
 * Service Name: Dio_Init
 * Service ID[hex]: 0x10
@@ -36,10 +157,15 @@ STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Initialize the Dio module.
+* Description: Function to Initialize the Dio module, it shall be called after Port_Init
+*              which selects the GPIO apertures.
 ************************************************************************************/
 void Dio_Init(const Dio_ConfigType * ConfigPtr)
 {
+#if (DIO_SOFT_PWM_API == STD_ON)
+	uint8 index;
+#endif
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* check if the input configuration pointer is not a NULL_PTR */
 	if (NULL_PTR == ConfigPtr)
@@ -47,6 +173,12 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID,
 		     DIO_E_PARAM_CONFIG);
 	}
+	/* check if the pre-computed addresses use the GPIO apertures selected by Port_Init */
+	else if ((REG_READ32(&DIO_SYSCTL_GPIOHBCTL_REG) & DIO_GPIOHBCTL_PORTS_MASK) != (uint32)(DIO_AHB_PORTS_MASK))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID,
+		     DIO_E_PARAM_APERTURE);
+	}
 	else
 #endif
 	{
@@ -56,6 +188,31 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 		 */
 		Dio_Status       = DIO_INITIALIZED;
 		Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+		Dio_Ports        = ConfigPtr->Ports;    /* address of the first Ports structure --> Ports[0] */
+		Dio_Groups       = ConfigPtr->Groups;   /* address of the first Groups structure --> Groups[0] */
+
+#if (DIO_EDGE_CAPTURE_API == STD_ON)
+		Dio_EdgeInit(ConfigPtr->Channels);
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+		Dio_DebounceInit(ConfigPtr->Channels);
+#endif
+
+#if (DIO_SOFT_PWM_API == STD_ON)
+		/* No channel is driven by the soft PWM, the schedules only hold the start of the period */
+		for(index = 0U; index < DIO_CONFIGURED_CHANNLES; index++)
+		{
+			Dio_SoftPwmDuty[index] = DIO_SOFT_PWM_OFF;
+		}
+		Dio_SoftPwmBuild(&Dio_SoftPwmSchedules[0]);
+		Dio_SoftPwmBuild(&Dio_SoftPwmSchedules[1]);
+		Dio_SoftPwmActive = 0U;
+		Dio_SoftPwmPending = FALSE;
+		Dio_SoftPwmNext = 0U;
+#endif
+
+		DIO_TRACE(DIO_INIT_SID, 0U, 0U);
 	}
 }
 
@@ -105,32 +262,29 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
+		/* Point to the pre-computed data address of the channel */
+		Port_Ptr = Dio_PortChannels[ChannelId].Data_Addr;
 		if(Level == STD_HIGH)
 		{
 			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+#if (DIO_MASKED_DATA_ACCESS == STD_ON)
+			/* The masked data alias only reaches the channel bit, so a single store writes the channel */
+			REG_WRITE32(Port_Ptr, DIO_DATA_ALL_BITS);
+#else
+			REG_SET_BITS(Port_Ptr, Dio_PortChannels[ChannelId].Mask);
+#endif
 		}
 		else if(Level == STD_LOW)
 		{
 			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+#if (DIO_MASKED_DATA_ACCESS == STD_ON)
+			REG_WRITE32(Port_Ptr, 0U);
+#else
+			REG_CLEAR_BITS(Port_Ptr, Dio_PortChannels[ChannelId].Mask);
+#endif
 		}
+
+		DIO_TRACE(DIO_WRITE_CHANNEL_SID, ChannelId, Level);
 	}
 	else
 	{
@@ -185,24 +339,10 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
+		/* Point to the pre-computed data address of the channel */
+		Port_Ptr = Dio_PortChannels[ChannelId].Data_Addr;
 		/* Read the required channel */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
+		if((REG_READ32(Port_Ptr) & Dio_PortChannels[ChannelId].Mask) != 0U)
 		{
 			output = STD_HIGH;
 		}
@@ -210,6 +350,253 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 		{
 			output = STD_LOW;
 		}
+
+		DIO_TRACE(DIO_READ_CHANNEL_SID, ChannelId, output);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WritePort
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a value of the port.
+************************************************************************************/
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the configured ports */
+	if (DIO_CONFIGURED_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Write all the 8 bits of the port with a single store, pins configured as input are not affected */
+		REG_WRITE32(Dio_Ports[PortId].Data_Addr, Level);
+
+		DIO_TRACE(DIO_WRITE_PORT_SID, PortId, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadPort
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all channels of that port.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the configured ports */
+	if (DIO_CONFIGURED_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Read all the 8 bits of the port with a single load */
+		output = (Dio_PortLevelType)REG_READ32(Dio_Ports[PortId].Data_Addr);
+
+		DIO_TRACE(DIO_READ_PORT_SID, PortId, output);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+/************************************************************************************
+* Function Name: Dio_CheckChannelGroup
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to the channel group passed to the API
+*                  ApiId - Service ID of the calling API
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if an error is reported to DET
+* Description: Function to run the DET checks shared by the channel group APIs.
+************************************************************************************/
+STATIC boolean Dio_CheckChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, uint8 ApiId)
+{
+	boolean error = FALSE;
+	uint8 counter;
+
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				ApiId, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the input pointer is not Null pointer */
+	else if (NULL_PTR == ChannelGroupIdPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				ApiId, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* Check if the pointer refers to one of the configured channel groups */
+		error = TRUE;
+		for (counter = 0U; counter < DIO_CONFIGURED_GROUPS; counter++)
+		{
+			if (&Dio_Groups[counter] == ChannelGroupIdPtr)
+			{
+				error = FALSE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		if (TRUE == error)
+		{
+			Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+					ApiId, DIO_E_PARAM_INVALID_GROUP);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	return error;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_WriteChannelGroup
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a subset of the adjoining bits of a port.
+************************************************************************************/
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	error = Dio_CheckChannelGroup(ChannelGroupIdPtr, DIO_WRITE_CHANNEL_GROUP_SID);
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/*
+		 * Shift the level to the group position and write it with a single store, the masked
+		 * data alias discards the bits outside the group so all the group bits change together
+		 */
+		REG_WRITE32(ChannelGroupIdPtr->Data_Addr, (uint32)Level << ChannelGroupIdPtr->offset);
+
+		DIO_TRACE(DIO_WRITE_CHANNEL_GROUP_SID, ChannelGroupIdPtr - Dio_Groups, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadChannelGroup
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to read a subset of the adjoining bits of a port.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr)
+{
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	error = Dio_CheckChannelGroup(ChannelGroupIdPtr, DIO_READ_CHANNEL_GROUP_SID);
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* The masked data alias returns the group bits only, shift them to the LSB */
+		output = (Dio_PortLevelType)(REG_READ32(ChannelGroupIdPtr->Data_Addr) >> ChannelGroupIdPtr->offset);
+
+		DIO_TRACE(DIO_READ_CHANNEL_GROUP_SID, ChannelGroupIdPtr - Dio_Groups, output);
 	}
 	else
 	{
@@ -253,6 +640,8 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 		versioninfo->sw_minor_version = (uint8)DIO_SW_MINOR_VERSION;
 		/* Copy Software Patch Version */
 		versioninfo->sw_patch_version = (uint8)DIO_SW_PATCH_VERSION;
+
+		DIO_TRACE(DIO_GET_VERSION_INFO_SID, 0U, 0U);
 	}
 }
 #endif
@@ -304,33 +693,29 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
+		/* Point to the pre-computed data address of the channel */
+		Port_Ptr = Dio_PortChannels[ChannelId].Data_Addr;
 		/* Read the required channel and write the required level */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
+		if((REG_READ32(Port_Ptr) & Dio_PortChannels[ChannelId].Mask) != 0U)
 		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+#if (DIO_MASKED_DATA_ACCESS == STD_ON)
+			REG_WRITE32(Port_Ptr, 0U);
+#else
+			REG_CLEAR_BITS(Port_Ptr, Dio_PortChannels[ChannelId].Mask);
+#endif
 			output = STD_LOW;
 		}
 		else
 		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+#if (DIO_MASKED_DATA_ACCESS == STD_ON)
+			REG_WRITE32(Port_Ptr, DIO_DATA_ALL_BITS);
+#else
+			REG_SET_BITS(Port_Ptr, Dio_PortChannels[ChannelId].Mask);
+#endif
 			output = STD_HIGH;
 		}
+
+		DIO_TRACE(DIO_FLIP_CHANNEL_SID, ChannelId, output);
 	}
 	else
 	{
@@ -339,3 +724,739 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
         return output;
 }
 #endif
+
+#if (DIO_EDGE_CAPTURE_API == STD_ON)
+/************************************************************************************
+* Service Name: Dio_EdgeIsr
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): PortId - ID of the GPIO port which raised the interrupt (PORTA = 0 ... PORTF = 5)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: GPIO port interrupt handler of the edge capture, to be called from the vector of
+*              the port. It clears the pending edges, then pushes one event per edge to the queue
+*              walking only the set bits of the masked interrupt status (Not exist in AUTOSAR).
+************************************************************************************/
+void Dio_EdgeIsr(Dio_PortType PortId)
+{
+	uint32 pending;
+	uint32 levels;
+	uint32 timestamp;
+	uint8 pin;
+	uint8 head;
+	Dio_EdgeEventType * event;
+
+	pending = REG_READ32(REG_ADDRESS(Dio_PortBases[PortId], PORT_INT_MASKED_STATUS_REG_OFFSET));
+
+	/* Clear the edges before reading the levels, so a later edge raises the interrupt again */
+	REG_WRITE32(REG_ADDRESS(Dio_PortBases[PortId], PORT_INT_CLEAR_REG_OFFSET), pending);
+
+	levels = REG_READ32(REG_ADDRESS(Dio_PortBases[PortId], PORT_DATA_REG_OFFSET));
+	timestamp = DIO_EDGE_TIMESTAMP();
+	head = Dio_EdgeHead;
+
+	while(pending != 0U)
+	{
+		pin = LOWEST_SET_BIT(pending);
+		pending &= pending - 1U;
+
+		if((uint8)(head - Dio_EdgeTail) < DIO_EDGE_QUEUE_SIZE)
+		{
+			event = &Dio_EdgeQueue[head & (DIO_EDGE_QUEUE_SIZE - 1U)];
+			event->Channel = Dio_EdgeChannels[PortId][pin];
+			event->Level = ((levels & ((uint32)1U << pin)) != 0U) ? STD_HIGH : STD_LOW;
+			event->Timestamp = timestamp;
+			head++;
+		}
+		else
+		{
+			Dio_EdgeOverflows++;
+		}
+	}
+
+	/* Publish the events to the consumer only after they are completely written */
+	COMPILER_BARRIER();
+	Dio_EdgeHead = head;
+}
+
+/************************************************************************************
+* Service Name: Dio_GetEdgeEvent
+* Service ID[hex]: 0x13
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): EventPtr - Pointer to where to store the oldest edge event
+* Return value: Std_ReturnType - E_OK: an event is read
+*                                E_NOT_OK: the queue is empty or a development error is detected
+* Description: Function to read the oldest edge event captured by Dio_EdgeIsr (Not exist in AUTOSAR).
+************************************************************************************/
+Std_ReturnType Dio_GetEdgeEvent(Dio_EdgeEventType * EventPtr)
+{
+	Std_ReturnType result = E_NOT_OK;
+	boolean error = FALSE;
+	uint8 tail;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_EDGE_EVENT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == EventPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_EDGE_EVENT_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		tail = Dio_EdgeTail;
+		if(tail != Dio_EdgeHead)
+		{
+			/* Read the event completely before its slot is released to the interrupt */
+			COMPILER_BARRIER();
+			*EventPtr = Dio_EdgeQueue[tail & (DIO_EDGE_QUEUE_SIZE - 1U)];
+			COMPILER_BARRIER();
+			Dio_EdgeTail = tail + 1U;
+			result = E_OK;
+
+			DIO_TRACE(DIO_GET_EDGE_EVENT_SID, EventPtr->Channel, EventPtr->Level);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return result;
+}
+
+/************************************************************************************
+* Service Name: Dio_GetEdgeOverflows
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of the edge events lost as the queue was full
+* Description: Function to get the number of the lost edge events (Not exist in AUTOSAR).
+************************************************************************************/
+uint32 Dio_GetEdgeOverflows(void)
+{
+	return Dio_EdgeOverflows;
+}
+
+/************************************************************************************
+* Function Name: Dio_EdgeInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Channels - The configured channels
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Configure the GPIO interrupt of every channel with an edge: edge sensitive,
+*              both edges or the single configured edge, clear any old edge and unmask it,
+*              then enable the interrupts of the used ports in the NVIC. The ports shall be
+*              initialized by Port_Init before.
+************************************************************************************/
+STATIC void Dio_EdgeInit(const Dio_ConfigChannel * Channels)
+{
+	uint8 port;
+	uint8 pin;
+	uint8 channel;
+	uint32 mask;
+	uint32 usedPorts = 0U;
+
+	for(port = 0U; port < DIO_NUMBER_OF_PORTS; port++)
+	{
+		for(pin = 0U; pin < DIO_PORT_PINS; pin++)
+		{
+			Dio_EdgeChannels[port][pin] = DIO_EDGE_NO_CHANNEL;
+		}
+	}
+	Dio_EdgeHead = 0U;
+	Dio_EdgeTail = 0U;
+	Dio_EdgeOverflows = 0U;
+
+	for(channel = 0U; channel < DIO_CONFIGURED_CHANNLES; channel++)
+	{
+		if(DIO_EDGE_NONE != Channels[channel].Edge)
+		{
+			port = Channels[channel].Port_Num;
+			mask = Channels[channel].Mask;
+			Dio_EdgeChannels[port][Channels[channel].Ch_Num] = channel;
+			usedPorts |= (uint32)1U << DIO_PORT_IRQ_NUMBER(port);
+
+			/* Mask the pin while its interrupt is configured */
+			REG_CLEAR_BITS(REG_ADDRESS(Dio_PortBases[port], PORT_INT_MASK_REG_OFFSET), mask);
+			REG_CLEAR_BITS(REG_ADDRESS(Dio_PortBases[port], PORT_INT_SENSE_REG_OFFSET), mask);
+			if(DIO_EDGE_BOTH == Channels[channel].Edge)
+			{
+				REG_SET_BITS(REG_ADDRESS(Dio_PortBases[port], PORT_INT_BOTH_EDGES_REG_OFFSET), mask);
+			}
+			else
+			{
+				REG_CLEAR_BITS(REG_ADDRESS(Dio_PortBases[port], PORT_INT_BOTH_EDGES_REG_OFFSET), mask);
+				if(DIO_EDGE_RISING == Channels[channel].Edge)
+				{
+					REG_SET_BITS(REG_ADDRESS(Dio_PortBases[port], PORT_INT_EVENT_REG_OFFSET), mask);
+				}
+				else
+				{
+					REG_CLEAR_BITS(REG_ADDRESS(Dio_PortBases[port], PORT_INT_EVENT_REG_OFFSET), mask);
+				}
+			}
+			REG_WRITE32(REG_ADDRESS(Dio_PortBases[port], PORT_INT_CLEAR_REG_OFFSET), mask);
+			REG_SET_BITS(REG_ADDRESS(Dio_PortBases[port], PORT_INT_MASK_REG_OFFSET), mask);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+
+	if(usedPorts != 0U)
+	{
+		REG_WRITE32(DIO_NVIC_EN0_ADDRESS, usedPorts);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+/************************************************************************************
+* Service Name: Dio_DebounceMainFunction
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Cyclic debouncing service to be called once per debounce tick. It samples every
+*              port which has configured channels with one read and runs a 2-bit vertical counter on the 8 pins of the
+*              port at once: a pin takes a new stable level after DIO_DEBOUNCE_SAMPLES equal
+*              samples and latches a press or a release event (Not exist in AUTOSAR).
+*              It shall not preempt, or be preempted by, the readers of the debounced channels.
+************************************************************************************/
+void Dio_DebounceMainFunction(void)
+{
+	uint8 index;
+	uint8 port;
+	uint8 changed;
+	uint8 active;
+
+	if (DIO_INITIALIZED == Dio_Status)
+	{
+		for(index = 0U; index < Dio_DebouncePortCount; index++)
+		{
+			port = Dio_DebouncePorts[index];
+
+			/* Pins which differ from their stable level, their counters run only while they differ */
+			changed = Dio_DebounceLevels[port] ^ (uint8)REG_READ32(REG_ADDRESS(Dio_PortBases[port], PORT_DATA_REG_OFFSET));
+			Dio_DebounceCount0[port] = (uint8)~(Dio_DebounceCount0[port] & changed);
+			Dio_DebounceCount1[port] = Dio_DebounceCount0[port] ^ (Dio_DebounceCount1[port] & changed);
+
+			/* Pins which differed for DIO_DEBOUNCE_SAMPLES samples (their counter wrapped) take the new level */
+			changed &= Dio_DebounceCount0[port] & Dio_DebounceCount1[port];
+			Dio_DebounceLevels[port] ^= changed;
+
+			/* Pins which are now at their active level */
+			active = Dio_DebounceLevels[port] ^ Dio_DebounceActiveLow[port];
+			Dio_DebouncePressed[port] |= changed & active;
+			Dio_DebounceReleased[port] |= changed & (uint8)(~active);
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_GetDebouncedLevel
+* Service ID[hex]: 0x14
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType
+* Description: Function to return the debounced level of the specified DIO channel (Not exist in AUTOSAR).
+************************************************************************************/
+Dio_LevelType Dio_GetDebouncedLevel(Dio_ChannelType ChannelId)
+{
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_DEBOUNCED_LEVEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_DEBOUNCED_LEVEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		if((Dio_DebounceLevels[Dio_PortChannels[ChannelId].Port_Num] & Dio_PortChannels[ChannelId].Mask) != 0U)
+		{
+			output = STD_HIGH;
+		}
+		else
+		{
+			output = STD_LOW;
+		}
+
+		DIO_TRACE(DIO_GET_DEBOUNCED_LEVEL_SID, ChannelId, output);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_GetDebounceEvent
+* Service ID[hex]: 0x15
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_DebounceEventType - DIO_DEBOUNCE_NO_EVENT or the latched DIO_DEBOUNCE_PRESSED
+*                                       and / or DIO_DEBOUNCE_RELEASED events
+* Description: Function to read and clear the press / release events of the specified DIO channel
+*              latched by Dio_DebounceMainFunction since the last call (Not exist in AUTOSAR).
+************************************************************************************/
+Dio_DebounceEventType Dio_GetDebounceEvent(Dio_ChannelType ChannelId)
+{
+	Dio_DebounceEventType output = DIO_DEBOUNCE_NO_EVENT;
+	boolean error = FALSE;
+	uint8 port;
+	uint8 mask;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_DEBOUNCE_EVENT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_DEBOUNCE_EVENT_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		port = Dio_PortChannels[ChannelId].Port_Num;
+		mask = (uint8)Dio_PortChannels[ChannelId].Mask;
+
+		if((Dio_DebouncePressed[port] & mask) != 0U)
+		{
+			output |= DIO_DEBOUNCE_PRESSED;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+		if((Dio_DebounceReleased[port] & mask) != 0U)
+		{
+			output |= DIO_DEBOUNCE_RELEASED;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		/* The events of the channel are consumed */
+		Dio_DebouncePressed[port] &= (uint8)(~mask);
+		Dio_DebounceReleased[port] &= (uint8)(~mask);
+
+		DIO_TRACE(DIO_GET_DEBOUNCE_EVENT_SID, ChannelId, output);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return output;
+}
+
+/************************************************************************************
+* Function Name: Dio_DebounceInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Channels - The configured channels
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Collect the ports of the configured channels (whether or not they are configured
+*              Dio ports), start the debouncing from their current levels without any event,
+*              and collect the pins which are active at low level.
+************************************************************************************/
+STATIC void Dio_DebounceInit(const Dio_ConfigChannel * Channels)
+{
+	uint8 index;
+	uint8 port;
+	boolean used[DIO_NUMBER_OF_PORTS];
+
+	for(port = 0U; port < DIO_NUMBER_OF_PORTS; port++)
+	{
+		used[port] = FALSE;
+		Dio_DebounceCount0[port] = DIO_DATA_ALL_BITS;
+		Dio_DebounceCount1[port] = DIO_DATA_ALL_BITS;
+		Dio_DebounceLevels[port] = 0U;
+		Dio_DebounceActiveLow[port] = 0U;
+		Dio_DebouncePressed[port] = 0U;
+		Dio_DebounceReleased[port] = 0U;
+	}
+	Dio_DebouncePortCount = 0U;
+
+	for(index = 0U; index < DIO_CONFIGURED_CHANNLES; index++)
+	{
+		port = Channels[index].Port_Num;
+		if(FALSE == used[port])
+		{
+			used[port] = TRUE;
+			Dio_DebouncePorts[Dio_DebouncePortCount] = port;
+			Dio_DebouncePortCount++;
+			Dio_DebounceLevels[port] = (uint8)REG_READ32(REG_ADDRESS(Dio_PortBases[port], PORT_DATA_REG_OFFSET));
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		if(STD_LOW == Channels[index].Active)
+		{
+			Dio_DebounceActiveLow[Channels[index].Port_Num] |= (uint8)Channels[index].Mask;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+}
+#endif
+
+#if (DIO_SOFT_PWM_API == STD_ON)
+/************************************************************************************
+* Service Name: Dio_SoftPwmSetDuty
+* Service ID[hex]: 0x16
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+*                  Duty - High time of the channel in timer ticks (0 ... DIO_SOFT_PWM_PERIOD),
+*                         or DIO_SOFT_PWM_OFF to release the channel from the soft PWM
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the duty cycle of a channel driven by the soft PWM. The schedule
+*              of the transitions is rebuilt here, out of the interrupt, and Dio_SoftPwmIsr
+*              switches to it at the start of the next period (Not exist in AUTOSAR).
+************************************************************************************/
+void Dio_SoftPwmSetDuty(Dio_ChannelType ChannelId, uint16 Duty)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_SOFT_PWM_SET_DUTY_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_SOFT_PWM_SET_DUTY_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		if((DIO_SOFT_PWM_OFF != Duty) && (Duty > DIO_SOFT_PWM_PERIOD))
+		{
+			Duty = DIO_SOFT_PWM_PERIOD;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+		Dio_SoftPwmDuty[ChannelId] = Duty;
+
+		/*
+		 * Withdraw any pending schedule before the free one is rebuilt: if the interrupt
+		 * already switched to it, the free schedule is the other one read below
+		 */
+		Dio_SoftPwmPending = FALSE;
+		COMPILER_BARRIER();
+		Dio_SoftPwmBuild(&Dio_SoftPwmSchedules[Dio_SoftPwmActive ^ 1U]);
+		COMPILER_BARRIER();
+		Dio_SoftPwmPending = TRUE;
+
+		DIO_TRACE(DIO_SOFT_PWM_SET_DUTY_SID, ChannelId, Duty);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_SoftPwmIsr
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - Timer ticks until the next call
+* Description: Timer interrupt handler of the soft PWM. It applies the next transition of the
+*              schedule with one masked GPIODATA store per port, and returns the number of timer
+*              ticks to the following transition to be loaded in the timer. At the start of a
+*              period it switches to the schedule rebuilt by Dio_SoftPwmSetDuty (Not exist in AUTOSAR).
+************************************************************************************/
+uint16 Dio_SoftPwmIsr(void)
+{
+	const Dio_SoftPwmScheduleType * schedule;
+	const Dio_SoftPwmTransitionType * transition;
+	uint8 index;
+	uint8 port;
+	uint8 value;
+	uint16 delay;
+
+	if(0U == Dio_SoftPwmNext)
+	{
+		/* Start of a period: take the new schedule if there is one */
+		if(TRUE == Dio_SoftPwmPending)
+		{
+			Dio_SoftPwmActive ^= 1U;
+			Dio_SoftPwmPending = FALSE;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	schedule = &Dio_SoftPwmSchedules[Dio_SoftPwmActive];
+	transition = &schedule->Transitions[Dio_SoftPwmNext];
+
+	for(index = 0U; index < schedule->PortCount; index++)
+	{
+		port = schedule->Ports[index];
+		if(transition->Masks[port] != 0U)
+		{
+			/* The start of the period sets the channels with a duty, the other transitions only clear */
+			value = (0U == Dio_SoftPwmNext) ? schedule->Set[port] : 0U;
+			REG_WRITE32(REG_ADDRESS(Dio_PortBases[port], (uint32)transition->Masks[port] << 2U), value);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+
+	Dio_SoftPwmNext++;
+	if(Dio_SoftPwmNext < schedule->Count)
+	{
+		delay = schedule->Transitions[Dio_SoftPwmNext].Tick - transition->Tick;
+	}
+	else
+	{
+		delay = DIO_SOFT_PWM_PERIOD - transition->Tick;
+		Dio_SoftPwmNext = 0U;
+	}
+	return delay;
+}
+
+/************************************************************************************
+* Function Name: Dio_SoftPwmBuild
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Schedule - The schedule to be built
+* Return value: None
+* Description: Build the schedule of one period from the duty cycles of the channels: the start
+*              of the period sets the channels with a duty and clears the others, then one
+*              transition per distinct duty clears all the channels with this duty, the
+*              transitions are sorted by their tick.
+************************************************************************************/
+STATIC void Dio_SoftPwmBuild(Dio_SoftPwmScheduleType * Schedule)
+{
+	uint8 channel;
+	uint8 index;
+	uint8 port;
+	uint8 mask;
+	uint16 duty;
+	boolean used[DIO_NUMBER_OF_PORTS];
+
+	for(port = 0U; port < DIO_NUMBER_OF_PORTS; port++)
+	{
+		used[port] = FALSE;
+		Schedule->Set[port] = 0U;
+		Schedule->Transitions[0].Masks[port] = 0U;
+	}
+	Schedule->Transitions[0].Tick = 0U;
+	Schedule->Count = 1U;
+	Schedule->PortCount = 0U;
+
+	for(channel = 0U; channel < DIO_CONFIGURED_CHANNLES; channel++)
+	{
+		duty = Dio_SoftPwmDuty[channel];
+		if(DIO_SOFT_PWM_OFF != duty)
+		{
+			port = Dio_PortChannels[channel].Port_Num;
+			mask = (uint8)Dio_PortChannels[channel].Mask;
+			if(FALSE == used[port])
+			{
+				used[port] = TRUE;
+				Schedule->Ports[Schedule->PortCount] = port;
+				Schedule->PortCount++;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+
+			/* Start of the period: every channel is written */
+			Schedule->Transitions[0].Masks[port] |= mask;
+			if(duty > 0U)
+			{
+				Schedule->Set[port] |= mask;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+
+			/* End of the high time: find or insert the transition of this duty in tick order */
+			if((duty > 0U) && (duty < DIO_SOFT_PWM_PERIOD))
+			{
+				index = 1U;
+				while((index < Schedule->Count) && (Schedule->Transitions[index].Tick < duty))
+				{
+					index++;
+				}
+				if((index == Schedule->Count) || (Schedule->Transitions[index].Tick != duty))
+				{
+					Dio_SoftPwmInsert(Schedule, index, duty);
+				}
+				else
+				{
+					/* No Action Required */
+				}
+				Schedule->Transitions[index].Masks[port] |= mask;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+}
+
+/************************************************************************************
+* Function Name: Dio_SoftPwmInsert
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Index - Position of the new transition
+*                  Tick - Tick of the new transition
+* Parameters (inout): Schedule - The schedule under construction
+* Parameters (out): None
+* Return value: None
+* Description: Insert an empty transition in the sorted list of transitions of the schedule.
+************************************************************************************/
+STATIC void Dio_SoftPwmInsert(Dio_SoftPwmScheduleType * Schedule, uint8 Index, uint16 Tick)
+{
+	uint8 position;
+	uint8 port;
+
+	for(position = Schedule->Count; position > Index; position--)
+	{
+		Schedule->Transitions[position] = Schedule->Transitions[position - 1U];
+	}
+	Schedule->Transitions[Index].Tick = Tick;
+	for(port = 0U; port < DIO_NUMBER_OF_PORTS; port++)
+	{
+		Schedule->Transitions[Index].Masks[port] = 0U;
+	}
+	Schedule->Count++;
+}
+#endif
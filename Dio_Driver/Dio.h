@@ -101,6 +101,18 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Service ID for DIO get edge event (Not exist in AUTOSAR 4.0.3 Dio SWS Document) */
+#define DIO_GET_EDGE_EVENT_SID         (uint8)0x13
+
+/* Service ID for DIO get debounced level (Not exist in AUTOSAR 4.0.3 Dio SWS Document) */
+#define DIO_GET_DEBOUNCED_LEVEL_SID    (uint8)0x14
+
+/* Service ID for DIO get debounce event (Not exist in AUTOSAR 4.0.3 Dio SWS Document) */
+#define DIO_GET_DEBOUNCE_EVENT_SID     (uint8)0x15
+
+/* Service ID for DIO soft PWM set duty (Not exist in AUTOSAR 4.0.3 Dio SWS Document) */
+#define DIO_SOFT_PWM_SET_DUTY_SID      (uint8)0x16
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -122,6 +134,12 @@
  */
 #define DIO_E_PARAM_POINTER             (uint8)0x20
 
+/*
+ * Dio_Init API service called while the GPIO apertures selected in GPIOHBCTL (by Port_Init)
+ * differ from DIO_AHB_PORTS_MASK (Not exist in AUTOSAR 4.0.3 DIO SWS Document)
+ */
+#define DIO_E_PARAM_APERTURE           (uint8)0x21
+
 /*
  * API service used without module initialization is reported using following
  * error code (Not exist in AUTOSAR 4.0.3 DIO SWS Document.
@@ -143,6 +161,34 @@ typedef uint8 Dio_LevelType;
 /* Type definition for Dio_PortLevelType used by the DIO APIs */
 typedef uint8 Dio_PortLevelType;
 
+/* Edges of a channel captured by Dio_EdgeIsr */
+#define DIO_EDGE_NONE                  (uint8)0x00
+#define DIO_EDGE_RISING                (uint8)0x01
+#define DIO_EDGE_FALLING               (uint8)0x02
+#define DIO_EDGE_BOTH                  (uint8)0x03
+
+/* Edge event of an input channel */
+typedef struct
+{
+	/* ID of the channel */
+	Dio_ChannelType Channel;
+	/* Level of the channel read after the edge */
+	Dio_LevelType Level;
+	/* Time stamp of the edge (DIO_EDGE_TIMESTAMP) */
+	uint32 Timestamp;
+} Dio_EdgeEventType;
+
+/* Type definition for the press / release events of the debounced channels */
+typedef uint8 Dio_DebounceEventType;
+
+/* Events of a debounced channel, a press and a release may be latched together */
+#define DIO_DEBOUNCE_NO_EVENT          (Dio_DebounceEventType)0x00
+#define DIO_DEBOUNCE_PRESSED           (Dio_DebounceEventType)0x01
+#define DIO_DEBOUNCE_RELEASED          (Dio_DebounceEventType)0x02
+
+/* Duty cycle of a channel which is not driven by the soft PWM */
+#define DIO_SOFT_PWM_OFF               (uint16)0xFFFF
+
 /* Structure for Dio_ChannelGroup */
 typedef struct
 {
@@ -152,6 +198,8 @@ typedef struct
   uint8 offset;
   /* This shall be the port ID which the Channel group is defined. */
   Dio_PortType PortIndex;
+  /* Pre-computed address of the GPIODATA alias which masks every bit outside the group */
+  volatile uint32 * Data_Addr;
 } Dio_ChannelGroupType;
 
 typedef struct
@@ -160,28 +208,55 @@ typedef struct
 	Dio_PortType Port_Num;
 	/* Member contains the ID of the Channel*/
 	Dio_ChannelType Ch_Num;
+	/* Member contains the edges of the channel captured by Dio_EdgeIsr (DIO_EDGE_NONE ... DIO_EDGE_BOTH) */
+	uint8 Edge;
+	/* Member contains the active level of the channel, a press drives it to this level (STD_HIGH / STD_LOW) */
+	Dio_LevelType Active;
+	/*
+	 * Member contains the pre-computed GPIODATA address of the channel: the alias which masks
+	 * every bit except the channel bit (DIO_MASKED_DATA_ACCESS ON) or the all-bits alias
+	 */
+	volatile uint32 * Data_Addr;
+	/* Member contains the bit mask of the channel inside its port */
+	uint32 Mask;
 }Dio_ConfigChannel;
 
+typedef struct
+{
+	/* Member contains the ID of the Port */
+	Dio_PortType Port_Num;
+	/* Member contains the pre-computed address of the GPIODATA alias which selects all the port bits */
+	volatile uint32 * Data_Addr;
+}Dio_ConfigPort;
+
 /* Data Structure required for initializing the Dio Driver */
 typedef struct Dio_ConfigType
 {
 	Dio_ConfigChannel Channels[DIO_CONFIGURED_CHANNLES];
+	Dio_ConfigPort Ports[DIO_CONFIGURED_PORTS];
+	Dio_ChannelGroupType Groups[DIO_CONFIGURED_GROUPS];
 } Dio_ConfigType;
 
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
-/* Function for DIO read Channel API */
+/* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 
-/* Function for DIO write Channel API */
+/* Function for DIO write Port API */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
 
-/* Function for DIO read Port API */
+/* Function for DIO read Channel Group API */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr);
+
+/* Function for DIO write Channel Group API */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level);
+
+/* Function for DIO read Channel API */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
-/* Function for DIO write Port API */
+/* Function for DIO write Channel API */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
 /* Function for DIO Initialization API */
@@ -192,6 +267,36 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr);
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
 #endif
 
+#if (DIO_EDGE_CAPTURE_API == STD_ON)
+/* GPIO port interrupt handler of the edge capture, called from the vector of the port */
+void Dio_EdgeIsr(Dio_PortType PortId);
+
+/* Function to read the oldest edge event, returns E_NOT_OK if there is no event */
+Std_ReturnType Dio_GetEdgeEvent(Dio_EdgeEventType * EventPtr);
+
+/* Function to get the number of the edge events lost as the queue was full */
+uint32 Dio_GetEdgeOverflows(void);
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+/* Cyclic debouncing service of the configured ports */
+void Dio_DebounceMainFunction(void);
+
+/* Function to return the debounced level of a channel */
+Dio_LevelType Dio_GetDebouncedLevel(Dio_ChannelType ChannelId);
+
+/* Function to read and clear the press / release events of a debounced channel */
+Dio_DebounceEventType Dio_GetDebounceEvent(Dio_ChannelType ChannelId);
+#endif
+
+#if (DIO_SOFT_PWM_API == STD_ON)
+/* Function to set the duty cycle of a channel driven by the soft PWM */
+void Dio_SoftPwmSetDuty(Dio_ChannelType ChannelId, uint16 Duty);
+
+/* Timer interrupt handler of the soft PWM, returns the timer ticks until its next call */
+uint16 Dio_SoftPwmIsr(void);
+#endif
+
 /* Function for DIO Get Version Info API */
 #if (DIO_VERSION_INFO_API == STD_ON)
 void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
@@ -204,4 +309,55 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
 /* Extern PB structures to be used by Dio and other modules */
 extern const Dio_ConfigType Dio_Configuration;
 
+/* Symbolic names of the configured Channel Groups to be passed to the Channel Group APIs */
+#define DioConf_RGB_LED_GROUP                (&Dio_Configuration.Groups[DioConf_RGB_LED_GROUP_ID_INDEX])
+
+#if (DIO_INLINE_API == STD_ON)
+/*******************************************************************************
+ *                 Inline Fast Path of the Pre-Compile Channels                *
+ *******************************************************************************/
+
+/* Registers of the GPIO ports and the register access backend of the fast path */
+#include "Dio_Regs.h"
+#include "Reg_Access.h"
+
+/*
+ * Compile time check of a channel of the fast path: the size of the array is negative, so the
+ * build fails, for the JTAG pins PC0 - PC3 which shall never be driven by the Dio.
+ * It evaluates nothing at run time.
+ */
+#define DIO_INLINE_CHECK_CHANNEL(PORT_NUM,CH_NUM) \
+	((void)sizeof(char[(((PORT_NUM) == 2U) && ((CH_NUM) < 4U)) ? -1 : 1]))
+
+/* Address of the GPIODATA alias of a configured channel, CHANNEL is its symbolic name (e.g. DioConf_LED1) */
+#define DIO_INLINE_ADDRESS(CHANNEL) \
+	DIO_CHANNEL_DATA_ADDRESS(CHANNEL##_PORT_NUM, CHANNEL##_CHANNEL_NUM)
+
+/*
+ * Write a level to a configured channel with one store to its masked GPIODATA alias,
+ * no configuration look up and no Det checks (Not exist in AUTOSAR).
+ */
+#define DIO_WRITE_CHANNEL_INLINE(CHANNEL,LEVEL) \
+	( DIO_INLINE_CHECK_CHANNEL(CHANNEL##_PORT_NUM, CHANNEL##_CHANNEL_NUM), \
+	  REG_WRITE32(DIO_INLINE_ADDRESS(CHANNEL), \
+	              (STD_HIGH == (LEVEL)) ? DIO_CHANNEL_MASK(CHANNEL##_CHANNEL_NUM) : 0U) )
+
+/*
+ * Read the level of a configured channel with one load of its masked GPIODATA alias
+ * (Not exist in AUTOSAR).
+ */
+#define DIO_READ_CHANNEL_INLINE(CHANNEL) \
+	( DIO_INLINE_CHECK_CHANNEL(CHANNEL##_PORT_NUM, CHANNEL##_CHANNEL_NUM), \
+	  (Dio_LevelType)((REG_READ32(DIO_INLINE_ADDRESS(CHANNEL)) != 0U) ? STD_HIGH : STD_LOW) )
+
+/*
+ * Flip the level of a configured channel with one load and one store of its masked GPIODATA
+ * alias, the other pins of the port are not touched (Not exist in AUTOSAR).
+ */
+#define DIO_FLIP_CHANNEL_INLINE(CHANNEL) \
+	( DIO_INLINE_CHECK_CHANNEL(CHANNEL##_PORT_NUM, CHANNEL##_CHANNEL_NUM), \
+	  REG_WRITE32(DIO_INLINE_ADDRESS(CHANNEL), \
+	              ~REG_READ32(DIO_INLINE_ADDRESS(CHANNEL)) & DIO_CHANNEL_MASK(CHANNEL##_CHANNEL_NUM)) )
+#endif
+
 #endif /* DIO_H */
@@ -26,8 +26,10 @@
 #define DIO_CFG_AR_RELEASE_MINOR_VERSION     (0U)
 #define DIO_CFG_AR_RELEASE_PATCH_VERSION     (3U)
 
-/* Pre-compile option for Development Error Detect */
+/* Pre-compile option for Development Error Detect (may be overridden by the build, e.g. the benchmarks) */
+#ifndef DIO_DEV_ERROR_DETECT
 #define DIO_DEV_ERROR_DETECT                (STD_ON)
+#endif
 
 /* Pre-compile option for Version Info API */
 #define DIO_VERSION_INFO_API                (STD_OFF)
@@ -35,6 +37,75 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
+/*
+ * Pre-compile option to access the channels through the GPIODATA address mask:
+ * each channel carries the address of the data alias which selects only its bit,
+ * so read/write/flip are single loads/stores instead of read-modify-write
+ */
+#ifndef DIO_MASKED_DATA_ACCESS
+#define DIO_MASKED_DATA_ACCESS              (STD_ON)
+#endif
+
+/*
+ * Pre-compile option for the edge capture of the input channels: Dio_Init enables the GPIO
+ * interrupt of every channel configured with an edge, Dio_EdgeIsr drains the interrupt
+ * status of a port into a queue of edge events and Dio_GetEdgeEvent reads them from a task
+ */
+#define DIO_EDGE_CAPTURE_API                (STD_ON)
+
+/* Number of the edge events in the queue (power of 2, maximum 128) */
+#define DIO_EDGE_QUEUE_SIZE                 (16U)
+
+/* Time stamp of the edge events: the SysTick current value (down counter) by default */
+#define DIO_EDGE_TIMESTAMP()                REG_READ32(DIO_SYSTICK_CURRENT_ADDRESS)
+
+/*
+ * Pre-compile option for the debouncing of the input channels: Dio_DebounceMainFunction samples
+ * every configured port once per call and debounces its 8 pins at once with vertical counters,
+ * a pin takes a new stable level after DIO_DEBOUNCE_SAMPLES equal consecutive samples
+ */
+#define DIO_DEBOUNCE_API                    (STD_ON)
+
+/* Number of the equal consecutive samples of the debouncing (fixed by the 2-bit vertical counters) */
+#define DIO_DEBOUNCE_SAMPLES                (4U)
+
+/*
+ * Pre-compile option for the soft PWM: Dio_SoftPwmSetDuty sorts the duty cycles of the channels
+ * into a short list of transitions, and every call of Dio_SoftPwmIsr from a timer interrupt applies
+ * only the next transition with one masked GPIODATA store per port
+ */
+#define DIO_SOFT_PWM_API                    (STD_ON)
+
+/* Period of the soft PWM in timer ticks */
+#define DIO_SOFT_PWM_PERIOD                 (256U)
+
+/*
+ * Pre-compile option for the inline fast path of the pre-compile channels: DIO_WRITE_CHANNEL_INLINE,
+ * DIO_READ_CHANNEL_INLINE and DIO_FLIP_CHANNEL_INLINE take the symbolic name of a configured channel
+ * (e.g. DioConf_LED1) and expand to one access of its masked GPIODATA alias computed at compile time
+ */
+#define DIO_INLINE_API                      (STD_ON)
+
+/*
+ * Pre-compile option to select the GPIO aperture of every port: bit n selects the AHB aperture
+ * for port n (PORTA = bit 0 ... PORTF = bit 5), all the pre-computed addresses of the channels,
+ * ports and groups use the selected aperture. It shall be the same as PORT_AHB_PORTS_MASK
+ * in Port_Cfg.h as Port_Init selects the apertures, Dio_Init reports DIO_E_PARAM_APERTURE to the
+ * Det when they differ (may be overridden by the build)
+ */
+#ifndef DIO_AHB_PORTS_MASK
+#define DIO_AHB_PORTS_MASK                  (0x00U)
+#endif
+
+/*
+ * Pre-compile option for the tracing of the service calls: every call which passes the Det checks
+ * is recorded by the Trace module (SID, channel, value and time stamp) in its RAM ring buffer.
+ * When it is OFF the trace points compile to nothing (may be overridden by the build)
+ */
+#ifndef DIO_TRACE_API
+#define DIO_TRACE_API                       (STD_OFF)
+#endif
+
 /* Number of the configured Dio Channels */
 #define DIO_CONFIGURED_CHANNLES              (2U)
 
@@ -50,4 +121,32 @@
 #define DioConf_LED1_CHANNEL_NUM             (Dio_ChannelType)1 /* Pin 1 in PORTF */
 #define DioConf_SW1_CHANNEL_NUM              (Dio_ChannelType)4 /* Pin 4 in PORTF */
 
+/* DIO Configured Channel edges captured by Dio_EdgeIsr */
+#define DioConf_LED1_CHANNEL_EDGE            DIO_EDGE_NONE
+#define DioConf_SW1_CHANNEL_EDGE             DIO_EDGE_BOTH
+
+/* DIO Configured Channel active levels, a press of SW1 drives it low (pull-up input) */
+#define DioConf_LED1_CHANNEL_ACTIVE          STD_HIGH
+#define DioConf_SW1_CHANNEL_ACTIVE           STD_LOW
+
+/* Number of the configured Dio Ports */
+#define DIO_CONFIGURED_PORTS                 (1U)
+
+/* Port Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_PORTF_PORT_ID_INDEX          (uint8)0x00
+
+/* DIO Configured Ports */
+#define DioConf_PORTF_PORT_NUM               (Dio_PortType)5 /* PORTF */
+
+/* Number of the configured Dio Channel Groups */
+#define DIO_CONFIGURED_GROUPS                (1U)
+
+/* Channel Group Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_RGB_LED_GROUP_ID_INDEX       (uint8)0x00
+
+/* DIO Configured Channel Groups */
+#define DioConf_RGB_LED_GROUP_PORT_NUM       (Dio_PortType)5 /* PORTF */
+#define DioConf_RGB_LED_GROUP_MASK           (uint8)0x0E     /* Pins 1, 2 and 3 in PORTF */
+#define DioConf_RGB_LED_GROUP_OFFSET         (uint8)1
+
 #endif /* DIO_CFG_H */
@@ -10,6 +10,7 @@
  ******************************************************************************/
 
 #include "Dio.h"
+#include "Dio_Regs.h"
 
 /*
  * Module Version 1.0.0
@@ -39,8 +40,33 @@
   #error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
+/*
+ * Initializer of one channel structure, the data address and the mask of the channel are
+ * resolved here at build time so the Dio APIs only index the table and access the register
+ */
+#if (DIO_MASKED_DATA_ACCESS == STD_ON)
+#define DIO_CHANNEL(PORT_NUM,CH_NUM,EDGE,ACTIVE)    {PORT_NUM,CH_NUM,EDGE,ACTIVE,DIO_CHANNEL_DATA_ADDRESS(PORT_NUM,CH_NUM),DIO_CHANNEL_MASK(CH_NUM)}
+#else
+#define DIO_CHANNEL(PORT_NUM,CH_NUM,EDGE,ACTIVE)    {PORT_NUM,CH_NUM,EDGE,ACTIVE,DIO_PORT_DATA_ADDRESS(PORT_NUM),DIO_CHANNEL_MASK(CH_NUM)}
+#endif
+
+/* Initializer of one port structure */
+#define DIO_PORT(PORT_NUM)              {PORT_NUM,DIO_PORT_DATA_ADDRESS(PORT_NUM)}
+
+/* Initializer of one channel group structure */
+#define DIO_CHANNEL_GROUP(PORT_NUM,MASK,OFFSET) \
+	{MASK,OFFSET,PORT_NUM,DIO_MASKED_DATA_ADDRESS(PORT_NUM,MASK)}
+
 /* PB structure used with Dio_Init API */
 const Dio_ConfigType Dio_Configuration = {
-                                             DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
-				             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
+                                           {
+                                             DIO_CHANNEL(DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,DioConf_LED1_CHANNEL_EDGE,DioConf_LED1_CHANNEL_ACTIVE),
+                                             DIO_CHANNEL(DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM,DioConf_SW1_CHANNEL_EDGE,DioConf_SW1_CHANNEL_ACTIVE)
+                                           },
+                                           {
+                                             DIO_PORT(DioConf_PORTF_PORT_NUM)
+                                           },
+                                           {
+                                             DIO_CHANNEL_GROUP(DioConf_RGB_LED_GROUP_PORT_NUM,DioConf_RGB_LED_GROUP_MASK,DioConf_RGB_LED_GROUP_OFFSET)
+                                           }
 				         };
@@ -14,6 +14,9 @@
 
 #include "Std_Types.h"
 
+/* Dio Pre-Compile Configuration Header file (GPIO aperture of the ports) */
+#include "Dio_Cfg.h"
+
 #define GPIO_PORTA_DATA_REG       (*((volatile uint32 *)0x400043FC))
 #define GPIO_PORTB_DATA_REG       (*((volatile uint32 *)0x400053FC))
 #define GPIO_PORTC_DATA_REG       (*((volatile uint32 *)0x400063FC))
@@ -21,4 +24,81 @@
 #define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
 #define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
 
+/* GPIO Registers base addresses of the first port of each block on the APB aperture */
+#define GPIO_PORTA_APB_BASE_ADDRESS       0x40004000
+#define GPIO_PORTE_APB_BASE_ADDRESS       0x40024000
+
+/* GPIO Registers base address of PORTA on the AHB aperture, the 6 ports are contiguous */
+#define GPIO_PORTA_AHB_BASE_ADDRESS       0x40058000
+
+/* GPIO aperture of every port (bit n set: port n on the AHB aperture), programmed by Port_Init */
+#define DIO_SYSCTL_GPIOHBCTL_REG          (*((volatile uint32 *)0x400FE06C))
+
+/* Bits of the GPIO ports (PORTA ... PORTF) in GPIOHBCTL */
+#define DIO_GPIOHBCTL_PORTS_MASK          (0x3FU)
+
+/* Number of the GPIO ports (PORTA ... PORTF) and of the pins of a port */
+#define DIO_NUMBER_OF_PORTS               (6U)
+#define DIO_PORT_PINS                     (8U)
+
+/* Offset of the GPIODATA alias which selects all the bits of the port */
+#define PORT_DATA_REG_OFFSET              0x3FC
+
+/* Value written through a masked GPIODATA alias to set all the selected bits */
+#define DIO_DATA_ALL_BITS                 (0xFFU)
+
+/* Base address of the GPIO port with the given Port ID (PORTA = 0 ... PORTF = 5) on the APB aperture */
+#define DIO_PORT_APB_BASE_ADDRESS(PORT_NUM) \
+	( ((PORT_NUM) < 4U) ? (GPIO_PORTA_APB_BASE_ADDRESS + ((uint32)(PORT_NUM) * 0x1000U)) \
+	                    : (GPIO_PORTE_APB_BASE_ADDRESS + ((uint32)((PORT_NUM) - 4U) * 0x1000U)) )
+
+/* Base address of the GPIO port with the given Port ID in the aperture selected by DIO_AHB_PORTS_MASK */
+#define DIO_PORT_BASE_ADDRESS(PORT_NUM) \
+	( ((((DIO_AHB_PORTS_MASK) >> (PORT_NUM)) & 1U) != 0U) \
+	                    ? (GPIO_PORTA_AHB_BASE_ADDRESS + ((uint32)(PORT_NUM) * 0x1000U)) \
+	                    : DIO_PORT_APB_BASE_ADDRESS(PORT_NUM) )
+
+/* GPIO Registers base addresses */
+#define GPIO_PORTA_BASE_ADDRESS           DIO_PORT_BASE_ADDRESS(0U)
+#define GPIO_PORTB_BASE_ADDRESS           DIO_PORT_BASE_ADDRESS(1U)
+#define GPIO_PORTC_BASE_ADDRESS           DIO_PORT_BASE_ADDRESS(2U)
+#define GPIO_PORTD_BASE_ADDRESS           DIO_PORT_BASE_ADDRESS(3U)
+#define GPIO_PORTE_BASE_ADDRESS           DIO_PORT_BASE_ADDRESS(4U)
+#define GPIO_PORTF_BASE_ADDRESS           DIO_PORT_BASE_ADDRESS(5U)
+
+/*
+ * Address of the GPIODATA alias for the given bits mask: address bits [9:2] are used as a mask
+ * for the access, so only the selected bits can be read or written through it
+ */
+#define DIO_MASKED_DATA_ADDRESS(PORT_NUM,MASK) \
+	((volatile uint32 *)(DIO_PORT_BASE_ADDRESS(PORT_NUM) + ((uint32)(MASK) << 2U)))
+
+/* Address of the GPIODATA alias which only reads/writes the bit of the channel */
+#define DIO_CHANNEL_DATA_ADDRESS(PORT_NUM,CH_NUM) \
+	DIO_MASKED_DATA_ADDRESS(PORT_NUM,(uint32)1U << (CH_NUM))
+
+/* Address of the GPIODATA alias which reads/writes all the bits of the port */
+#define DIO_PORT_DATA_ADDRESS(PORT_NUM) \
+	((volatile uint32 *)(DIO_PORT_BASE_ADDRESS(PORT_NUM) + PORT_DATA_REG_OFFSET))
+
+/* Offsets of the GPIO interrupt registers from the port base address */
+#define PORT_INT_SENSE_REG_OFFSET         0x404
+#define PORT_INT_BOTH_EDGES_REG_OFFSET    0x408
+#define PORT_INT_EVENT_REG_OFFSET         0x40C
+#define PORT_INT_MASK_REG_OFFSET          0x410
+#define PORT_INT_MASKED_STATUS_REG_OFFSET 0x418
+#define PORT_INT_CLEAR_REG_OFFSET         0x41C
+
+/* NVIC interrupt set enable register of the interrupts 0 - 31 (write 1 to enable) */
+#define DIO_NVIC_EN0_ADDRESS              ((volatile uint32 *)0xE000E100)
+
+/* NVIC interrupt number of the GPIO port with the given Port ID (GPIO Port F is interrupt 30) */
+#define DIO_PORT_IRQ_NUMBER(PORT_NUM)     (((PORT_NUM) < 5U) ? (uint32)(PORT_NUM) : 30U)
+
+/* SysTick current value register, the default time stamp of the edge events */
+#define DIO_SYSTICK_CURRENT_ADDRESS       ((volatile uint32 *)0xE000E018)
+
+/* Bit mask of the channel inside its port */
+#define DIO_CHANNEL_MASK(CH_NUM)          ((uint32)1U << (CH_NUM))
+
 #endif /* DIO_REGS_H */
@@ -0,0 +1,836 @@
+ /******************************************************************************
+ *
+ * Module: Reg_Sim
+ *
+ * File Name: Reg_Sim.c
+ *
+ * Description: Source file for the host simulation of the TM4C123GH6PM registers.
+ *              It is only part of the host builds (REG_ACCESS_BACKEND = REG_ACCESS_HOST_SIM),
+ *              the register pointers used by the drivers are never dereferenced on the host,
+ *              their values are decoded here as physical addresses of the MCU memory map.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#include <stdint.h>
+
+#include "Reg_Sim.h"
+
+/*******************************************************************************
+ *                              Memory Map                                     *
+ *******************************************************************************/
+/* GPIO ports A..D on the APB aperture */
+#define REG_SIM_GPIO_APB_LOW_BASE          (0x40004000UL)
+#define REG_SIM_GPIO_APB_LOW_END           (0x40007FFFUL)
+
+/* GPIO ports E..F on the APB aperture */
+#define REG_SIM_GPIO_APB_HIGH_BASE         (0x40024000UL)
+#define REG_SIM_GPIO_APB_HIGH_END          (0x40025FFFUL)
+
+/* GPIO ports A..F on the AHB aperture (selected per port in GPIOHBCTL) */
+#define REG_SIM_GPIO_AHB_BASE              (0x40058000UL)
+#define REG_SIM_GPIO_AHB_END               (0x4005DFFFUL)
+
+/* Bit-band alias of the peripherals: every word is one bit of a register of 0x40000000 - 0x400FFFFF */
+#define REG_SIM_BITBAND_ALIAS_BASE         (0x42000000UL)
+#define REG_SIM_BITBAND_ALIAS_END          (0x43FFFFFFUL)
+#define REG_SIM_BITBAND_PERIPH_BASE        (0x40000000UL)
+
+/* Register and bit of a bit-band alias address */
+#define REG_SIM_BITBAND_REG(ADDRESS)       (REG_SIM_BITBAND_PERIPH_BASE + ((((ADDRESS) - REG_SIM_BITBAND_ALIAS_BASE) >> 5U) & ~3UL))
+#define REG_SIM_BITBAND_BIT(ADDRESS)       ((((ADDRESS) - REG_SIM_BITBAND_ALIAS_BASE) >> 2U) & 31UL)
+
+/* System Control block */
+#define REG_SIM_SYSCTL_BASE                (0x400FE000UL)
+#define REG_SIM_SYSCTL_END                 (0x400FEFFFUL)
+
+/* System Control Space (SysTick, NVIC, SCB) */
+#define REG_SIM_SCS_BASE                   (0xE000E000UL)
+#define REG_SIM_SCS_END                    (0xE000EFFFUL)
+
+/* Every simulated block is 4KB wide */
+#define REG_SIM_BLOCK_SHIFT                (12U)
+#define REG_SIM_BLOCK_MASK                 (0xFFFUL)
+#define REG_SIM_BLOCK_WORDS                (1024U)
+
+/*******************************************************************************
+ *                         GPIO Registers Offsets                              *
+ *******************************************************************************/
+#define REG_SIM_GPIO_DATA_END              (0x3FCUL)
+#define REG_SIM_GPIO_DIR                   (0x400UL)
+#define REG_SIM_GPIO_IS                    (0x404UL)
+#define REG_SIM_GPIO_IBE                   (0x408UL)
+#define REG_SIM_GPIO_IEV                   (0x40CUL)
+#define REG_SIM_GPIO_IM                    (0x410UL)
+#define REG_SIM_GPIO_RIS                   (0x414UL)
+#define REG_SIM_GPIO_MIS                   (0x418UL)
+#define REG_SIM_GPIO_ICR                   (0x41CUL)
+#define REG_SIM_GPIO_AFSEL                 (0x420UL)
+#define REG_SIM_GPIO_PUR                   (0x510UL)
+#define REG_SIM_GPIO_PDR                   (0x514UL)
+#define REG_SIM_GPIO_DEN                   (0x51CUL)
+#define REG_SIM_GPIO_LOCK                  (0x520UL)
+#define REG_SIM_GPIO_CR                    (0x524UL)
+#define REG_SIM_GPIO_AMSEL                 (0x528UL)
+#define REG_SIM_GPIO_PCTL                  (0x52CUL)
+
+/* Value to be written in GPIOLOCK to unlock GPIOCR */
+#define REG_SIM_GPIO_UNLOCK_VALUE          (0x4C4F434BUL)
+
+/* Index of a register inside the words array of its block */
+#define REG_SIM_WORD(OFFSET)               ((OFFSET) >> 2U)
+
+/*******************************************************************************
+ *                        System Registers Offsets                             *
+ *******************************************************************************/
+#define REG_SIM_SYSCTL_GPIOHBCTL           (0x06CUL)
+#define REG_SIM_SYSCTL_RCGC2               (0x108UL)
+#define REG_SIM_SYSCTL_RCGCGPIO            (0x608UL)
+#define REG_SIM_SYSCTL_PRGPIO              (0xA08UL)
+
+#define REG_SIM_SYSTICK_CTRL               (0x010UL)
+#define REG_SIM_SYSTICK_RELOAD             (0x014UL)
+#define REG_SIM_SYSTICK_CURRENT            (0x018UL)
+
+#define REG_SIM_SYSTICK_ENABLE             (0x00000001UL)
+#define REG_SIM_SYSTICK_COUNT_FLAG         (0x00010000UL)
+#define REG_SIM_SYSTICK_MAX                (0x00FFFFFFUL)
+
+/* Clock gating bits of the GPIO ports in RCGC2 / RCGCGPIO */
+#define REG_SIM_GPIO_CLOCKS_MASK           (0x3FUL)
+
+/* Value of the exclusive monitor when it is not open on any register */
+#define REG_SIM_MONITOR_CLOSED             (0UL)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+	/* Registers of the port above the data aperture, indexed by offset / 4 */
+	uint32 Regs[REG_SIM_BLOCK_WORDS];
+	/* Value latched in GPIODATA */
+	uint32 Data;
+	/* Levels driven on the pins from outside the MCU */
+	uint32 Input;
+	/* Status of GPIOLOCK: TRUE after writing the unlock value */
+	boolean Unlocked;
+} RegSim_GpioPortType;
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+/* Pins which are locked after reset and need GPIOCR to be committed (PC0-PC3, PD7, PF0) */
+STATIC const uint32 RegSim_LockedPins[REG_SIM_GPIO_PORTS] = {0x00UL, 0x00UL, 0x0FUL, 0x80UL, 0x00UL, 0x01UL};
+
+STATIC RegSim_GpioPortType RegSim_Gpio[REG_SIM_GPIO_PORTS];
+STATIC uint32 RegSim_Sysctl[REG_SIM_BLOCK_WORDS];
+STATIC uint32 RegSim_Scs[REG_SIM_BLOCK_WORDS];
+STATIC RegSim_StatsType RegSim_Stats;
+STATIC boolean RegSim_Initialized = FALSE;
+
+/*
+ * Exclusive monitor: address of the register of the last exclusive read, closed by any write.
+ * It is only updated with atomic accesses, so the decision of an exclusive write is one compare-exchange
+ */
+STATIC uint32 RegSim_Monitor = REG_SIM_MONITOR_CLOSED;
+
+/* Simulated interrupt run once before the next exclusive write */
+STATIC RegSim_PreemptHookType RegSim_PreemptHook = NULL_PTR;
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+STATIC RegSim_GpioPortType * RegSim_GpioPortOf(uint32 Address, uint8 * PortIndex);
+STATIC uint32 RegSim_PinLevels(const RegSim_GpioPortType * Port);
+STATIC void RegSim_UpdateInterrupts(RegSim_GpioPortType * Port, uint32 OldLevels);
+STATIC uint32 RegSim_Load(uint32 Address, boolean SideEffects);
+STATIC void RegSim_Store(uint32 Address, uint32 Value);
+STATIC void RegSim_Tick(void);
+
+/*******************************************************************************
+ *                         Functions Definitions                               *
+ *******************************************************************************/
+
+/************************************************************************************
+ * Service Name: RegSim_Reset
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Put all the simulated registers in their power-on reset state.
+ ************************************************************************************/
+void RegSim_Reset(void)
+{
+	uint8 port;
+	uint32 word;
+
+	for (port = 0U; port < REG_SIM_GPIO_PORTS; port++)
+	{
+		for (word = 0U; word < REG_SIM_BLOCK_WORDS; word++)
+		{
+			RegSim_Gpio[port].Regs[word] = 0UL;
+		}
+		RegSim_Gpio[port].Data = 0UL;
+		RegSim_Gpio[port].Input = 0UL;
+		RegSim_Gpio[port].Unlocked = FALSE;
+
+		/* The locked pins can not be changed until GPIOCR is committed */
+		RegSim_Gpio[port].Regs[REG_SIM_WORD(REG_SIM_GPIO_CR)] = 0xFFUL & ~RegSim_LockedPins[port];
+	}
+
+	/* PC0-PC3 are the JTAG/SWD pins: digital, alternate function 1 with pull up after reset */
+	RegSim_Gpio[2].Regs[REG_SIM_WORD(REG_SIM_GPIO_AFSEL)] = 0x0FUL;
+	RegSim_Gpio[2].Regs[REG_SIM_WORD(REG_SIM_GPIO_PUR)]   = 0x0FUL;
+	RegSim_Gpio[2].Regs[REG_SIM_WORD(REG_SIM_GPIO_DEN)]   = 0x0FUL;
+	RegSim_Gpio[2].Regs[REG_SIM_WORD(REG_SIM_GPIO_PCTL)]  = 0x00001111UL;
+
+	for (word = 0U; word < REG_SIM_BLOCK_WORDS; word++)
+	{
+		RegSim_Sysctl[word] = 0UL;
+		RegSim_Scs[word] = 0UL;
+	}
+
+	__atomic_store_n(&RegSim_Monitor, REG_SIM_MONITOR_CLOSED, __ATOMIC_SEQ_CST);
+	RegSim_PreemptHook = NULL_PTR;
+	RegSim_ClearStats();
+	RegSim_Initialized = TRUE;
+}
+
+/************************************************************************************
+ * Service Name: RegSim_Read32
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): Reg - Register pointer used by the driver (physical address of the MCU)
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Value of the simulated register
+ * Description: Simulated 32-bit register read.
+ ************************************************************************************/
+uint32 RegSim_Read32(const volatile uint32 * Reg)
+{
+	if (FALSE == RegSim_Initialized)
+	{
+		RegSim_Reset();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	RegSim_Stats.Reads++;
+	RegSim_Tick();
+	return RegSim_Load((uint32)(uintptr_t)Reg, TRUE);
+}
+
+/************************************************************************************
+ * Service Name: RegSim_Write32
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): Reg - Register pointer used by the driver (physical address of the MCU)
+ *                  Value - Value to be written
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Simulated 32-bit register write.
+ ************************************************************************************/
+void RegSim_Write32(volatile uint32 * Reg, uint32 Value)
+{
+	if (FALSE == RegSim_Initialized)
+	{
+		RegSim_Reset();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	RegSim_Stats.Writes++;
+	RegSim_Tick();
+
+	/* Any write between an exclusive read and its exclusive write makes this one fail, as an interrupt would */
+	__atomic_store_n(&RegSim_Monitor, REG_SIM_MONITOR_CLOSED, __ATOMIC_SEQ_CST);
+	RegSim_Store((uint32)(uintptr_t)Reg, Value);
+}
+
+/************************************************************************************
+ * Service Name: RegSim_ReadExclusive32
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): Reg - Register pointer used by the driver (physical address of the MCU)
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Value of the simulated register
+ * Description: Simulated exclusive 32-bit register read (LDREX): the read opens the
+ *              exclusive monitor on the register.
+ ************************************************************************************/
+uint32 RegSim_ReadExclusive32(const volatile uint32 * Reg)
+{
+	if (FALSE == RegSim_Initialized)
+	{
+		RegSim_Reset();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	RegSim_Stats.Reads++;
+	RegSim_Tick();
+	__atomic_store_n(&RegSim_Monitor, (uint32)(uintptr_t)Reg, __ATOMIC_SEQ_CST);
+	return RegSim_Load((uint32)(uintptr_t)Reg, TRUE);
+}
+
+/************************************************************************************
+ * Service Name: RegSim_WriteExclusive32
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): Reg - Register pointer used by the driver (physical address of the MCU)
+ *                  Value - Value to be written
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - 0 if the register is written, 1 if the monitor was closed
+ * Description: Simulated exclusive 32-bit register write (STREX): the register is written
+ *              only if the monitor is still open on it, the monitor is closed in both cases.
+ *              A failed write does not access the bus. A pending preemption hook runs first,
+ *              as an interrupt taken between the exclusive read and the write.
+ ************************************************************************************/
+uint32 RegSim_WriteExclusive32(volatile uint32 * Reg, uint32 Value)
+{
+	uint32 expected = (uint32)(uintptr_t)Reg;
+	uint32 status = 1UL;
+	RegSim_PreemptHookType hook = RegSim_PreemptHook;
+
+	if (FALSE == RegSim_Initialized)
+	{
+		RegSim_Reset();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	/* one-shot: cleared before it runs, so its own exclusive accesses are not preempted */
+	if (NULL_PTR != hook)
+	{
+		RegSim_PreemptHook = NULL_PTR;
+		hook();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if (__atomic_compare_exchange_n(&RegSim_Monitor, &expected, REG_SIM_MONITOR_CLOSED, 0,
+			__ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+	{
+		RegSim_Stats.Writes++;
+		RegSim_Tick();
+		RegSim_Store((uint32)(uintptr_t)Reg, Value);
+		status = 0UL;
+	}
+	else
+	{
+		/* the monitor is closed on a failure too, the next exclusive read opens it again */
+		__atomic_store_n(&RegSim_Monitor, REG_SIM_MONITOR_CLOSED, __ATOMIC_SEQ_CST);
+	}
+	return status;
+}
+
+/************************************************************************************
+ * Service Name: RegSim_SetPreemptHook
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): Hook - Code of the simulated interrupt, NULL_PTR to cancel it
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Run a hook once at the next exclusive write, after its exclusive read: it
+ *              models an interrupt between LDREX and STREX which updates the same register.
+ ************************************************************************************/
+void RegSim_SetPreemptHook(RegSim_PreemptHookType Hook)
+{
+	RegSim_PreemptHook = Hook;
+}
+
+/************************************************************************************
+ * Service Name: RegSim_SetPinLevel
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): PortIndex - Port of the pin (PORTA = 0 ... PORTF = 5)
+ *                  Pin - Pin number inside the port
+ *                  Level - STD_HIGH or STD_LOW
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Drive the external level of a pin, the edge/level detection of
+ *              the port is evaluated as the hardware would do it.
+ ************************************************************************************/
+void RegSim_SetPinLevel(uint8 PortIndex, uint8 Pin, uint8 Level)
+{
+	RegSim_GpioPortType * port;
+	uint32 oldLevels;
+
+	if (FALSE == RegSim_Initialized)
+	{
+		RegSim_Reset();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if ((PortIndex < REG_SIM_GPIO_PORTS) && (Pin < 8U))
+	{
+		port = &RegSim_Gpio[PortIndex];
+		oldLevels = RegSim_PinLevels(port);
+		if (STD_HIGH == Level)
+		{
+			port->Input |= ((uint32)1U << Pin);
+		}
+		else
+		{
+			port->Input &= ~((uint32)1U << Pin);
+		}
+		RegSim_UpdateInterrupts(port, oldLevels);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Service Name: RegSim_GetPinLevel
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): PortIndex - Port of the pin (PORTA = 0 ... PORTF = 5)
+ *                  Pin - Pin number inside the port
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint8 - STD_HIGH or STD_LOW
+ * Description: Get the level seen on a pin: the GPIODATA value if the pin is an output
+ *              or the external level if the pin is an input.
+ ************************************************************************************/
+uint8 RegSim_GetPinLevel(uint8 PortIndex, uint8 Pin)
+{
+	const RegSim_GpioPortType * port;
+	uint32 level;
+	uint8 output = STD_LOW;
+
+	if ((PortIndex < REG_SIM_GPIO_PORTS) && (Pin < 8U))
+	{
+		port = &RegSim_Gpio[PortIndex];
+		level = (port->Data & port->Regs[REG_SIM_WORD(REG_SIM_GPIO_DIR)]) |
+				(port->Input & ~port->Regs[REG_SIM_WORD(REG_SIM_GPIO_DIR)]);
+		if ((level & ((uint32)1U << Pin)) != 0UL)
+		{
+			output = STD_HIGH;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return output;
+}
+
+/************************************************************************************
+ * Service Name: RegSim_Peek32
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): Address - Physical address of the register
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Value of the simulated register
+ * Description: Read a register without side effects and without counting the access.
+ ************************************************************************************/
+uint32 RegSim_Peek32(uint32 Address)
+{
+	if (FALSE == RegSim_Initialized)
+	{
+		RegSim_Reset();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return RegSim_Load(Address, FALSE);
+}
+
+/************************************************************************************
+ * Service Name: RegSim_GetStats
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): Stats - Pointer to where to store the statistics
+ * Return value: None
+ * Description: Get the statistics of the simulated bus accesses.
+ ************************************************************************************/
+void RegSim_GetStats(RegSim_StatsType * Stats)
+{
+	if (NULL_PTR != Stats)
+	{
+		*Stats = RegSim_Stats;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Service Name: RegSim_ClearStats
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Clear the statistics of the simulated bus accesses.
+ ************************************************************************************/
+void RegSim_ClearStats(void)
+{
+	RegSim_Stats.Reads = 0UL;
+	RegSim_Stats.Writes = 0UL;
+	RegSim_Stats.Faults = 0UL;
+}
+
+/************************************************************************************
+ * Function Name: RegSim_GpioPortOf
+ * Description: Return the simulated GPIO port of an address or NULL_PTR if the address
+ *              is not inside a GPIO block. A port is only mapped in the aperture selected
+ *              for it in GPIOHBCTL (APB after reset), the other aperture is unmapped.
+ ************************************************************************************/
+STATIC RegSim_GpioPortType * RegSim_GpioPortOf(uint32 Address, uint8 * PortIndex)
+{
+	RegSim_GpioPortType * port = NULL_PTR;
+	boolean ahb = FALSE;
+
+	if ((Address >= REG_SIM_GPIO_APB_LOW_BASE) && (Address <= REG_SIM_GPIO_APB_LOW_END))
+	{
+		*PortIndex = (uint8)((Address - REG_SIM_GPIO_APB_LOW_BASE) >> REG_SIM_BLOCK_SHIFT);
+		port = &RegSim_Gpio[*PortIndex];
+	}
+	else if ((Address >= REG_SIM_GPIO_APB_HIGH_BASE) && (Address <= REG_SIM_GPIO_APB_HIGH_END))
+	{
+		*PortIndex = (uint8)(4U + ((Address - REG_SIM_GPIO_APB_HIGH_BASE) >> REG_SIM_BLOCK_SHIFT));
+		port = &RegSim_Gpio[*PortIndex];
+	}
+	else if ((Address >= REG_SIM_GPIO_AHB_BASE) && (Address <= REG_SIM_GPIO_AHB_END))
+	{
+		*PortIndex = (uint8)((Address - REG_SIM_GPIO_AHB_BASE) >> REG_SIM_BLOCK_SHIFT);
+		port = &RegSim_Gpio[*PortIndex];
+		ahb = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if ((NULL_PTR != port) &&
+			(((RegSim_Sysctl[REG_SIM_WORD(REG_SIM_SYSCTL_GPIOHBCTL)] >> *PortIndex) & 1UL) != (uint32)ahb))
+	{
+		/* The port is accessed through the aperture which is not selected for it */
+		port = NULL_PTR;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return port;
+}
+
+/************************************************************************************
+ * Function Name: RegSim_PinLevels
+ * Description: Return the levels read back through GPIODATA: the latched value for the
+ *              outputs and the external level for the inputs, only for digital enabled pins.
+ ************************************************************************************/
+STATIC uint32 RegSim_PinLevels(const RegSim_GpioPortType * Port)
+{
+	uint32 dir = Port->Regs[REG_SIM_WORD(REG_SIM_GPIO_DIR)];
+
+	return ((Port->Data & dir) | (Port->Input & ~dir)) & Port->Regs[REG_SIM_WORD(REG_SIM_GPIO_DEN)] & 0xFFUL;
+}
+
+/************************************************************************************
+ * Function Name: RegSim_UpdateInterrupts
+ * Description: Evaluate the interrupt detection of a port after its pin levels or its
+ *              interrupt configuration may have changed, the detected events are latched
+ *              in GPIORIS as configured by GPIOIS, GPIOIBE and GPIOIEV.
+ ************************************************************************************/
+STATIC void RegSim_UpdateInterrupts(RegSim_GpioPortType * Port, uint32 OldLevels)
+{
+	uint32 levels = RegSim_PinLevels(Port);
+	uint32 changed = levels ^ OldLevels;
+	uint32 is  = Port->Regs[REG_SIM_WORD(REG_SIM_GPIO_IS)];
+	uint32 ibe = Port->Regs[REG_SIM_WORD(REG_SIM_GPIO_IBE)];
+	uint32 iev = Port->Regs[REG_SIM_WORD(REG_SIM_GPIO_IEV)];
+	uint32 edges;
+	uint32 active;
+
+	/* Edge sensitive pins: both edges, rising edges (IEV = 1) or falling edges (IEV = 0) */
+	edges = ~is & changed & (ibe | (iev & levels) | (~iev & ~levels));
+
+	/* Level sensitive pins: high level (IEV = 1) or low level (IEV = 0) */
+	active = is & ((iev & levels) | (~iev & ~levels));
+
+	Port->Regs[REG_SIM_WORD(REG_SIM_GPIO_RIS)] |= (edges | active) & 0xFFUL;
+}
+
+/************************************************************************************
+ * Function Name: RegSim_Tick
+ * Description: Advance the SysTick down counter by one tick, the simulation counts one
+ *              tick per bus access so the SysTick based measurements are deterministic.
+ ************************************************************************************/
+STATIC void RegSim_Tick(void)
+{
+	uint32 * ctrl    = &RegSim_Scs[REG_SIM_WORD(REG_SIM_SYSTICK_CTRL)];
+	uint32 * current = &RegSim_Scs[REG_SIM_WORD(REG_SIM_SYSTICK_CURRENT)];
+
+	if ((*ctrl & REG_SIM_SYSTICK_ENABLE) != 0UL)
+	{
+		if (0UL == *current)
+		{
+			*current = RegSim_Scs[REG_SIM_WORD(REG_SIM_SYSTICK_RELOAD)] & REG_SIM_SYSTICK_MAX;
+			*ctrl |= REG_SIM_SYSTICK_COUNT_FLAG;
+		}
+		else
+		{
+			(*current)--;
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Function Name: RegSim_Load
+ * Description: Decode the address and return the value of the simulated register,
+ *              the read side effects (e.g. SysTick COUNT flag) are only applied if requested.
+ ************************************************************************************/
+STATIC uint32 RegSim_Load(uint32 Address, boolean SideEffects)
+{
+	RegSim_GpioPortType * port;
+	uint8 portIndex = 0U;
+	uint32 offset = Address & REG_SIM_BLOCK_MASK & ~3UL;
+	uint32 value = 0UL;
+
+	port = RegSim_GpioPortOf(Address, &portIndex);
+	if ((Address >= REG_SIM_BITBAND_ALIAS_BASE) && (Address <= REG_SIM_BITBAND_ALIAS_END))
+	{
+		/* A read of the alias returns the bit of the register in bit 0 */
+		value = (RegSim_Load(REG_SIM_BITBAND_REG(Address), SideEffects) >> REG_SIM_BITBAND_BIT(Address)) & 1UL;
+	}
+	else if (NULL_PTR != port)
+	{
+		if ((RegSim_Sysctl[REG_SIM_WORD(REG_SIM_SYSCTL_RCGC2)] & ((uint32)1U << portIndex)) == 0UL)
+		{
+			/* Accessing a GPIO port while its clock is gated is a bus fault */
+			RegSim_Stats.Faults += (TRUE == SideEffects) ? 1UL : 0UL;
+		}
+		else if (offset <= REG_SIM_GPIO_DATA_END)
+		{
+			/* Address bits [9:2] mask the bits which can be read */
+			value = RegSim_PinLevels(port) & (offset >> 2U);
+		}
+		else if (REG_SIM_GPIO_MIS == offset)
+		{
+			value = port->Regs[REG_SIM_WORD(REG_SIM_GPIO_RIS)] & port->Regs[REG_SIM_WORD(REG_SIM_GPIO_IM)];
+		}
+		else if (REG_SIM_GPIO_LOCK == offset)
+		{
+			value = (TRUE == port->Unlocked) ? 0UL : 1UL;
+		}
+		else
+		{
+			value = port->Regs[REG_SIM_WORD(offset)];
+		}
+	}
+	else if ((Address >= REG_SIM_SYSCTL_BASE) && (Address <= REG_SIM_SYSCTL_END))
+	{
+		if (REG_SIM_SYSCTL_PRGPIO == offset)
+		{
+			/* The ports are ready as soon as their clock is enabled */
+			value = RegSim_Sysctl[REG_SIM_WORD(REG_SIM_SYSCTL_RCGC2)] & REG_SIM_GPIO_CLOCKS_MASK;
+		}
+		else
+		{
+			value = RegSim_Sysctl[REG_SIM_WORD(offset)];
+		}
+	}
+	else if ((Address >= REG_SIM_SCS_BASE) && (Address <= REG_SIM_SCS_END))
+	{
+		value = RegSim_Scs[REG_SIM_WORD(offset)];
+		if ((REG_SIM_SYSTICK_CTRL == offset) && (TRUE == SideEffects))
+		{
+			/* The COUNT flag is cleared by reading the control register */
+			RegSim_Scs[REG_SIM_WORD(offset)] &= ~REG_SIM_SYSTICK_COUNT_FLAG;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* Unmapped address */
+		RegSim_Stats.Faults += (TRUE == SideEffects) ? 1UL : 0UL;
+	}
+	return value;
+}
+
+/************************************************************************************
+ * Function Name: RegSim_Store
+ * Description: Decode the address and apply a write to the simulated register with
+ *              the TM4C semantics of this register.
+ ************************************************************************************/
+STATIC void RegSim_Store(uint32 Address, uint32 Value)
+{
+	RegSim_GpioPortType * port;
+	uint8 portIndex = 0U;
+	uint32 offset = Address & REG_SIM_BLOCK_MASK & ~3UL;
+	uint32 oldLevels;
+	uint32 commit;
+	uint32 mask;
+
+	port = RegSim_GpioPortOf(Address, &portIndex);
+	if ((Address >= REG_SIM_BITBAND_ALIAS_BASE) && (Address <= REG_SIM_BITBAND_ALIAS_END))
+	{
+		/* A write of the alias is a read-modify-write of one bit of the register done by the bus */
+		mask = (uint32)1U << REG_SIM_BITBAND_BIT(Address);
+		RegSim_Store(REG_SIM_BITBAND_REG(Address),
+				(RegSim_Load(REG_SIM_BITBAND_REG(Address), FALSE) & ~mask) | (((Value & 1UL) != 0UL) ? mask : 0UL));
+	}
+	else if (NULL_PTR != port)
+	{
+		if ((RegSim_Sysctl[REG_SIM_WORD(REG_SIM_SYSCTL_RCGC2)] & ((uint32)1U << portIndex)) == 0UL)
+		{
+			/* Accessing a GPIO port while its clock is gated is a bus fault */
+			RegSim_Stats.Faults++;
+			return;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		oldLevels = RegSim_PinLevels(port);
+		commit = port->Regs[REG_SIM_WORD(REG_SIM_GPIO_CR)];
+
+		if (offset <= REG_SIM_GPIO_DATA_END)
+		{
+			/* Address bits [9:2] mask the bits which are written, the other bits keep their value */
+			mask = offset >> 2U;
+			port->Data = (port->Data & ~mask) | (Value & mask);
+		}
+		else
+		{
+			switch (offset)
+			{
+			case REG_SIM_GPIO_RIS:
+			case REG_SIM_GPIO_MIS:
+				/* Read only registers */
+				break;
+
+			case REG_SIM_GPIO_ICR:
+				/* Write 1 to clear the interrupt status */
+				port->Regs[REG_SIM_WORD(REG_SIM_GPIO_RIS)] &= ~Value;
+				break;
+
+			case REG_SIM_GPIO_LOCK:
+				port->Unlocked = (REG_SIM_GPIO_UNLOCK_VALUE == Value) ? TRUE : FALSE;
+				break;
+
+			case REG_SIM_GPIO_CR:
+				/* Only the bits of the locked pins are writable and only while GPIOLOCK is unlocked */
+				if (TRUE == port->Unlocked)
+				{
+					port->Regs[REG_SIM_WORD(offset)] = (commit & ~RegSim_LockedPins[portIndex]) |
+							(Value & RegSim_LockedPins[portIndex]);
+				}
+				else
+				{
+					/* No Action Required */
+				}
+				break;
+
+			case REG_SIM_GPIO_AFSEL:
+			case REG_SIM_GPIO_DEN:
+				/* Bits of the pins which are not committed in GPIOCR keep their value */
+				port->Regs[REG_SIM_WORD(offset)] = (port->Regs[REG_SIM_WORD(offset)] & ~commit) | (Value & commit);
+				break;
+
+			case REG_SIM_GPIO_PUR:
+				/* Committed write, enabling a pull up disables the pull down of the pin */
+				port->Regs[REG_SIM_WORD(offset)] = (port->Regs[REG_SIM_WORD(offset)] & ~commit) | (Value & commit);
+				port->Regs[REG_SIM_WORD(REG_SIM_GPIO_PDR)] &= ~(Value & commit);
+				break;
+
+			case REG_SIM_GPIO_PDR:
+				/* Committed write, enabling a pull down disables the pull up of the pin */
+				port->Regs[REG_SIM_WORD(offset)] = (port->Regs[REG_SIM_WORD(offset)] & ~commit) | (Value & commit);
+				port->Regs[REG_SIM_WORD(REG_SIM_GPIO_PUR)] &= ~(Value & commit);
+				break;
+
+			default:
+				port->Regs[REG_SIM_WORD(offset)] = Value;
+				break;
+			}
+		}
+
+		/* A change of the levels or of the detection configuration may raise interrupts */
+		RegSim_UpdateInterrupts(port, oldLevels);
+	}
+	else if ((Address >= REG_SIM_SYSCTL_BASE) && (Address <= REG_SIM_SYSCTL_END))
+	{
+		if ((REG_SIM_SYSCTL_RCGC2 == offset) || (REG_SIM_SYSCTL_RCGCGPIO == offset))
+		{
+			/* The legacy RCGC2 register and RCGCGPIO gate the same GPIO clocks */
+			RegSim_Sysctl[REG_SIM_WORD(REG_SIM_SYSCTL_RCGC2)] =
+					(RegSim_Sysctl[REG_SIM_WORD(REG_SIM_SYSCTL_RCGC2)] & ~REG_SIM_GPIO_CLOCKS_MASK) |
+					(Value & REG_SIM_GPIO_CLOCKS_MASK);
+			RegSim_Sysctl[REG_SIM_WORD(REG_SIM_SYSCTL_RCGCGPIO)] = Value & REG_SIM_GPIO_CLOCKS_MASK;
+			if (REG_SIM_SYSCTL_RCGC2 == offset)
+			{
+				RegSim_Sysctl[REG_SIM_WORD(offset)] = Value;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		else if (REG_SIM_SYSCTL_PRGPIO == offset)
+		{
+			/* Read only register */
+		}
+		else
+		{
+			RegSim_Sysctl[REG_SIM_WORD(offset)] = Value;
+		}
+	}
+	else if ((Address >= REG_SIM_SCS_BASE) && (Address <= REG_SIM_SCS_END))
+	{
+		if (REG_SIM_SYSTICK_CURRENT == offset)
+		{
+			/* Any write clears the current value and the COUNT flag */
+			RegSim_Scs[REG_SIM_WORD(offset)] = 0UL;
+			RegSim_Scs[REG_SIM_WORD(REG_SIM_SYSTICK_CTRL)] &= ~REG_SIM_SYSTICK_COUNT_FLAG;
+		}
+		else
+		{
+			RegSim_Scs[REG_SIM_WORD(offset)] = Value;
+		}
+	}
+	else
+	{
+		/* Unmapped address */
+		RegSim_Stats.Faults++;
+	}
+}
@@ -0,0 +1,97 @@
+ /******************************************************************************
+ *
+ * Module: Reg_Sim
+ *
+ * File Name: Reg_Sim.h
+ *
+ * Description: Header file for the host simulation of the TM4C123GH6PM registers.
+ *              The GPIO ports A..F (0x40004000 - 0x40025FFF), the System Control block
+ *              and the System Control Space (SysTick, NVIC) are mapped to an in-process
+ *              register file which models the TM4C behavior needed by the drivers.
+ *              The ports are also mapped on the AHB aperture (0x40058000 - 0x4005DFFF),
+ *              every port is only accessible through the aperture selected in GPIOHBCTL:
+ *              - GPIODATA address mask (address bits [9:2] select the accessed bits)
+ *              - GPIOLOCK / GPIOCR commit protection of AFSEL, PUR, PDR and DEN
+ *              - Port clock gating through RCGC2 / RCGCGPIO (bus fault when gated)
+ *              - GPIOPUR / GPIOPDR mutual exclusion
+ *              - Edge / level interrupt detection (RIS, MIS, ICR)
+ *              - SysTick down counter advancing one tick per bus access
+ *              - Exclusive monitor of LDREX / STREX, closed by any other write, and a one-shot
+ *                preemption hook run between them to model an interrupt
+ *              - Bit-band alias of the peripherals (0x42000000 - 0x43FFFFFF), a write of
+ *                an alias word is one access which updates one bit of the register
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#ifndef REG_SIM_H
+#define REG_SIM_H
+
+#include "Std_Types.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define REG_SIM_SW_MAJOR_VERSION           (1U)
+#define REG_SIM_SW_MINOR_VERSION           (0U)
+#define REG_SIM_SW_PATCH_VERSION           (0U)
+
+/* Number of the simulated GPIO ports (PORTA ... PORTF) */
+#define REG_SIM_GPIO_PORTS                 (6U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Statistics of the simulated bus accesses */
+typedef struct
+{
+	/* Number of register reads */
+	uint32 Reads;
+	/* Number of register writes */
+	uint32 Writes;
+	/* Number of accesses to unmapped addresses or to ports with gated clock */
+	uint32 Faults;
+} RegSim_StatsType;
+
+/* Code of a simulated interrupt which preempts the driver */
+typedef void (*RegSim_PreemptHookType)(void);
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Put all the simulated registers in their power-on reset state and clear the statistics */
+void RegSim_Reset(void);
+
+/* Simulated 32-bit register read */
+uint32 RegSim_Read32(const volatile uint32 * Reg);
+
+/* Simulated 32-bit register write */
+void RegSim_Write32(volatile uint32 * Reg, uint32 Value);
+
+/* Simulated exclusive read (LDREX): read a register and open the exclusive monitor on it */
+uint32 RegSim_ReadExclusive32(const volatile uint32 * Reg);
+
+/* Simulated exclusive write (STREX): write the register only if the monitor is still open on it, returns 0 if written */
+uint32 RegSim_WriteExclusive32(volatile uint32 * Reg, uint32 Value);
+
+/* Run a hook once at the next exclusive write, between its exclusive read and the write (NULL_PTR: none) */
+void RegSim_SetPreemptHook(RegSim_PreemptHookType Hook);
+
+/* Drive the external level of a pin, used to simulate the inputs (may raise GPIO interrupts) */
+void RegSim_SetPinLevel(uint8 PortIndex, uint8 Pin, uint8 Level);
+
+/* Get the level seen on a pin: the GPIODATA value for outputs or the external level for inputs */
+uint8 RegSim_GetPinLevel(uint8 PortIndex, uint8 Pin);
+
+/* Read a register without side effects and without counting it in the statistics */
+uint32 RegSim_Peek32(uint32 Address);
+
+/* Get the statistics of the simulated bus accesses */
+void RegSim_GetStats(RegSim_StatsType * Stats);
+
+/* Clear the statistics of the simulated bus accesses */
+void RegSim_ClearStats(void);
+
+#endif /* REG_SIM_H */
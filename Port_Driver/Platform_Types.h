@@ -1,84 +0,0 @@
- /******************************************************************************
- *
- * Module: Common - Platform Abstraction
- *
- * File Name: Platform_Types.h
- *
- * Description: Platform types for ARM Cortex-M4F
- *
- * Author: Mohamed Tarek
- *
- *******************************************************************************/
-
-#ifndef PLATFORM_TYPES_H
-#define PLATFORM_TYPES_H
-
-/* Id for the company in the AUTOSAR
- * for example Mohamed Tarek's ID = 1000 :) */
-#define PLATFORM_VENDOR_ID                          (1000U)
-
-/*
- * Module Version 1.0.0
- */
-#define PLATFORM_SW_MAJOR_VERSION                   (1U)
-#define PLATFORM_SW_MINOR_VERSION                   (0U)
-#define PLATFORM_SW_PATCH_VERSION                   (0U)
-
-/*
- * AUTOSAR Version 4.0.3
- */
-#define PLATFORM_AR_RELEASE_MAJOR_VERSION           (4U)
-#define PLATFORM_AR_RELEASE_MINOR_VERSION           (0U)
-#define PLATFORM_AR_RELEASE_PATCH_VERSION           (3U)
-
-/*
- * CPU register type width
- */
-#define CPU_TYPE_8                                  (8U)
-#define CPU_TYPE_16                                 (16U)
-#define CPU_TYPE_32                                 (32U)
-
-/*
- * Bit order definition
- */
-#define MSB_FIRST                   (0u)        /* Big endian bit ordering        */
-#define LSB_FIRST                   (1u)        /* Little endian bit ordering     */
-
-/*
- * Byte order definition
- */
-#define HIGH_BYTE_FIRST             (0u)        /* Big endian byte ordering       */
-#define LOW_BYTE_FIRST              (1u)        /* Little endian byte ordering    */
-
-/*
- * Platform type and endianess definitions, specific for ARM Cortex-M4F
- */
-#define CPU_TYPE            CPU_TYPE_32
-
-#define CPU_BIT_ORDER       LSB_FIRST
-#define CPU_BYTE_ORDER      LOW_BYTE_FIRST
-
-/*
- * Boolean Values
- */
-#ifndef FALSE
-#define FALSE       (0u)
-#endif
-#ifndef TRUE
-#define TRUE        (1u)
-#endif
-
-typedef unsigned char         boolean;
-
-typedef unsigned char         uint8;          /*           0 .. 255             */
-typedef signed char           sint8;          /*        -128 .. +127            */
-typedef unsigned short        uint16;         /*           0 .. 65535           */
-typedef signed short          sint16;         /*      -32768 .. +32767          */
-typedef unsigned long         uint32;         /*           0 .. 4294967295      */
-typedef signed long           sint32;         /* -2147483648 .. +2147483647     */
-typedef unsigned long long    uint64;         /*       0..18446744073709551615  */
-typedef signed long long      sint64;
-typedef float                 float32;
-typedef double                float64;
-
-#endif /* PLATFORM_TYPES_H */
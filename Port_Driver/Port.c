@@ -11,6 +11,7 @@
 
 #include "Port.h"
 #include "Port_Regs.h"
+#include "Reg_Access.h"
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
@@ -26,6 +27,14 @@
 
 #endif   
 
+#if (PORT_TRACE_API == STD_ON)
+/* Trace module: records the service calls in its RAM ring buffer */
+#include "Trace.h"
+#define PORT_TRACE(SID,PIN,VALUE)    Trace_Record(PORT_MODULE_ID, (SID), (uint8)(PIN), (uint32)(VALUE))
+#else
+#define PORT_TRACE(SID,PIN,VALUE)
+#endif
+
 /*
  *global variable to use it in all port functions
  *variable to detect the status of the port--> Initialized or Not
@@ -33,22 +42,210 @@
  */
 STATIC uint8 g_Port_Status = PORT_NOT_INITIALIZED;
 
-/*
- * global variable to use it in all port functions
- *variable to store the status of the JTAG pins in the MCU
- *which changed to high status if the JTAG pins are accessed
- *to be safe from using this pins
- */
-STATIC uint8 g_JTAG_flag = STD_LOW;
+#if (PORT_CONFIG_VALIDATED == STD_ON)
+/* The modes of the configuration are checked at compile time by Port_PBcfg.c */
+#define PORT_CONFIG_MODE_IS_VALID(MODE)    (TRUE)
+#else
+#define PORT_CONFIG_MODE_IS_VALID(MODE)    PORT_MODE_IS_VALID(MODE)
+#endif
+
+#if (PORT_BITBAND_ACCESS == STD_ON)
+/* Single-bit update of a GPIO register: one store to the bit-band alias of the bit */
+#define PORT_SET_BIT(REG_PTR,BIT)          REG_BITBAND_SET_BIT((REG_PTR),(BIT))
+#define PORT_CLEAR_BIT(REG_PTR,BIT)        REG_BITBAND_CLEAR_BIT((REG_PTR),(BIT))
+#else
+#define PORT_SET_BIT(REG_PTR,BIT)          REG_SET_BIT((REG_PTR),(BIT))
+#define PORT_CLEAR_BIT(REG_PTR,BIT)        REG_CLEAR_BIT((REG_PTR),(BIT))
+#endif
 
 /*helper pointer to carry the address of the passed array of structure*/
 STATIC const volatile Port_ConfigType * g_Port_helperPtr = NULL_PTR;
 
+/*helper pointer to the register images of the active profile (the images of Port_Init without profiles)*/
+STATIC const volatile Port_PortImageType * g_Port_images = NULL_PTR;
+
+#if (PORT_PROFILES_API == STD_ON)
+/*active profile of the pins configuration*/
+STATIC Port_ProfileType g_Port_profile = PORT_PROFILE_RUN;
+#endif
+
+#if (PORT_LOW_POWER_API == STD_ON)
+/*status of the low power mode, the parked pins and the gated ports are not accessed while it is TRUE*/
+STATIC boolean g_Port_lowPower = FALSE;
+
+/*registers of the parked pins of every port saved by Port_EnterLowPower, Pins is the mask of the parked pins*/
+STATIC Port_PortImageType g_Port_savedImages[PORT_NUMBER_OF_PORTS];
+
+/*clock gating bits of the ports gated by Port_EnterLowPower*/
+STATIC uint32 g_Port_gatedPorts = INITIAL_VALUE;
+
+/* Value of GPIOPUR and GPIOPDR for the parked pins */
+#define PORT_PARK_PUR_VALUE   ((PORT_LOW_POWER_PARK_RESISTOR == PULL_UP) ? 0xFFU : 0x00U)
+#define PORT_PARK_PDR_VALUE   ((PORT_LOW_POWER_PARK_RESISTOR == PULL_DOWN) ? 0xFFU : 0x00U)
+
+/*
+ * Non AUTOSAR private function to save the bits of some pins in a register and write their parked value
+ */
+STATIC uint8 Port_parkRegister(volatile uint32 * Reg, uint8 Pins, uint8 Value);
+#endif
+
+/*
+ * Lookup table of the location of every pin ID: the base address of its port registers,
+ * its port and its actual number in the port (0 ... 7), indexed by (pin ID - PORTA_FIRST_PIN)
+ */
+STATIC const Port_PinLocationType Port_PinLocations[PORT_NUMBER_OF_PINS] =
+{
+		/* PORTA: PA0 ... PA7 */
+		{(volatile uint32 *)GPIO_PORTA_BASE_ADDRESS, PORTA, 0U},
+		{(volatile uint32 *)GPIO_PORTA_BASE_ADDRESS, PORTA, 1U},
+		{(volatile uint32 *)GPIO_PORTA_BASE_ADDRESS, PORTA, 2U},
+		{(volatile uint32 *)GPIO_PORTA_BASE_ADDRESS, PORTA, 3U},
+		{(volatile uint32 *)GPIO_PORTA_BASE_ADDRESS, PORTA, 4U},
+		{(volatile uint32 *)GPIO_PORTA_BASE_ADDRESS, PORTA, 5U},
+		{(volatile uint32 *)GPIO_PORTA_BASE_ADDRESS, PORTA, 6U},
+		{(volatile uint32 *)GPIO_PORTA_BASE_ADDRESS, PORTA, 7U},
+		/* PORTB: PB0 ... PB7 */
+		{(volatile uint32 *)GPIO_PORTB_BASE_ADDRESS, PORTB, 0U},
+		{(volatile uint32 *)GPIO_PORTB_BASE_ADDRESS, PORTB, 1U},
+		{(volatile uint32 *)GPIO_PORTB_BASE_ADDRESS, PORTB, 2U},
+		{(volatile uint32 *)GPIO_PORTB_BASE_ADDRESS, PORTB, 3U},
+		{(volatile uint32 *)GPIO_PORTB_BASE_ADDRESS, PORTB, 4U},
+		{(volatile uint32 *)GPIO_PORTB_BASE_ADDRESS, PORTB, 5U},
+		{(volatile uint32 *)GPIO_PORTB_BASE_ADDRESS, PORTB, 6U},
+		{(volatile uint32 *)GPIO_PORTB_BASE_ADDRESS, PORTB, 7U},
+		/* PORTC: PC0 ... PC7 */
+		{(volatile uint32 *)GPIO_PORTC_BASE_ADDRESS, PORTC, 0U},
+		{(volatile uint32 *)GPIO_PORTC_BASE_ADDRESS, PORTC, 1U},
+		{(volatile uint32 *)GPIO_PORTC_BASE_ADDRESS, PORTC, 2U},
+		{(volatile uint32 *)GPIO_PORTC_BASE_ADDRESS, PORTC, 3U},
+		{(volatile uint32 *)GPIO_PORTC_BASE_ADDRESS, PORTC, 4U},
+		{(volatile uint32 *)GPIO_PORTC_BASE_ADDRESS, PORTC, 5U},
+		{(volatile uint32 *)GPIO_PORTC_BASE_ADDRESS, PORTC, 6U},
+		{(volatile uint32 *)GPIO_PORTC_BASE_ADDRESS, PORTC, 7U},
+		/* PORTD: PD0 ... PD7 */
+		{(volatile uint32 *)GPIO_PORTD_BASE_ADDRESS, PORTD, 0U},
+		{(volatile uint32 *)GPIO_PORTD_BASE_ADDRESS, PORTD, 1U},
+		{(volatile uint32 *)GPIO_PORTD_BASE_ADDRESS, PORTD, 2U},
+		{(volatile uint32 *)GPIO_PORTD_BASE_ADDRESS, PORTD, 3U},
+		{(volatile uint32 *)GPIO_PORTD_BASE_ADDRESS, PORTD, 4U},
+		{(volatile uint32 *)GPIO_PORTD_BASE_ADDRESS, PORTD, 5U},
+		{(volatile uint32 *)GPIO_PORTD_BASE_ADDRESS, PORTD, 6U},
+		{(volatile uint32 *)GPIO_PORTD_BASE_ADDRESS, PORTD, 7U},
+		/* PORTE: PE0 ... PE5 */
+		{(volatile uint32 *)GPIO_PORTE_BASE_ADDRESS, PORTE, 0U},
+		{(volatile uint32 *)GPIO_PORTE_BASE_ADDRESS, PORTE, 1U},
+		{(volatile uint32 *)GPIO_PORTE_BASE_ADDRESS, PORTE, 2U},
+		{(volatile uint32 *)GPIO_PORTE_BASE_ADDRESS, PORTE, 3U},
+		{(volatile uint32 *)GPIO_PORTE_BASE_ADDRESS, PORTE, 4U},
+		{(volatile uint32 *)GPIO_PORTE_BASE_ADDRESS, PORTE, 5U},
+		/* PORTF: PF0 ... PF4 */
+		{(volatile uint32 *)GPIO_PORTF_BASE_ADDRESS, PORTF, 0U},
+		{(volatile uint32 *)GPIO_PORTF_BASE_ADDRESS, PORTF, 1U},
+		{(volatile uint32 *)GPIO_PORTF_BASE_ADDRESS, PORTF, 2U},
+		{(volatile uint32 *)GPIO_PORTF_BASE_ADDRESS, PORTF, 3U},
+		{(volatile uint32 *)GPIO_PORTF_BASE_ADDRESS, PORTF, 4U}
+};
+
+/* Location of a valid pin ID in the lookup table */
+#define PORT_PIN_LOCATION(PIN)           (&Port_PinLocations[(PIN) - PORTA_FIRST_PIN])
+
+/* Base address of the GPIO registers of every port */
+STATIC volatile uint32 * const Port_BaseAddresses[PORT_NUMBER_OF_PORTS] =
+{
+		(volatile uint32 *)GPIO_PORTA_BASE_ADDRESS,
+		(volatile uint32 *)GPIO_PORTB_BASE_ADDRESS,
+		(volatile uint32 *)GPIO_PORTC_BASE_ADDRESS,
+		(volatile uint32 *)GPIO_PORTD_BASE_ADDRESS,
+		(volatile uint32 *)GPIO_PORTE_BASE_ADDRESS,
+		(volatile uint32 *)GPIO_PORTF_BASE_ADDRESS
+};
+
+/*
+ * Non AUTOSAR private function to refresh the direction of the
+ * direction unchangeable pins of one port
+ */
+STATIC void Port_refreshPort(uint8 Port);
+
+#if (PORT_REFRESH_ROUND_ROBIN == STD_ON)
+/* The next port refreshed by Port_RefreshPortDirection in the round robin mode */
+STATIC uint8 g_Port_refreshNext = PORTA;
+#endif
+
+#if (PORT_SCRUB_API == STD_ON)
+
+/*
+ * Expected register images of the ports checked by the scrubber,
+ * copied from the configuration by Port_Init and updated by Port_SetPinMode
+ */
+STATIC Port_PortImageType g_Port_expectedImages[PORT_NUMBER_OF_PORTS];
+
+/* Counters of the scrubber */
+STATIC Port_ScrubCountersType g_Port_scrubCounters;
+
+/* Offsets of the registers checked by the scrubber, indexed by PORT_SCRUB_DEN ... PORT_SCRUB_PCTL */
+STATIC const uint16 Port_ScrubOffsets[PORT_SCRUB_REGISTERS] =
+{
+		PORT_DIGITAL_ENABLE_REG_OFFSET,
+		PORT_ALT_FUNC_REG_OFFSET,
+		PORT_ANALOG_MODE_SEL_REG_OFFSET,
+		PORT_PULL_UP_REG_OFFSET,
+		PORT_PULL_DOWN_REG_OFFSET,
+		PORT_PCTL_REG_OFFSET
+};
+
+#if (PORT_SCRUB_INCREMENTAL == STD_ON)
+/* The next register checked by the scrubber in the incremental mode (Port * PORT_SCRUB_REGISTERS + Register) */
+STATIC uint8 g_Port_scrubNext = INITIAL_VALUE;
+#endif
+
+/*
+ * Non AUTOSAR private functions of the register scrubber
+ */
+STATIC boolean Port_scrubRegister(uint8 Port, uint8 Register);
+
+#endif
+
+#if (((PORT_SCRUB_API == STD_ON) && (PORT_SET_PIN_MODE_API == STD_ON)) || (PORT_SET_PINS_CONFIG_API == STD_ON))
+/*
+ * Non AUTOSAR private function to set the mode of a pin in a register image
+ */
+STATIC void Port_imageSetMode(Port_PortImageType * Image, uint8 Bit, Port_PinModeType Mode);
+#endif
+
+#if (PORT_BATCHED_INIT == STD_ON)
+/*
+ * Non AUTOSAR private function of the batched initialization
+ */
+STATIC void Port_writeImages(const Port_PortImageType * Images);
+#endif
+
+#if ((PORT_BATCHED_INIT == STD_ON) || (PORT_SET_PINS_CONFIG_API == STD_ON) || (PORT_PROFILES_API == STD_ON) ||\
+		(PORT_LOW_POWER_API == STD_ON))
+
+/* Pins implemented in every port (PORTE has 6 pins and PORTF has 5 pins) */
+STATIC const uint8 Port_ImplementedPins[PORT_NUMBER_OF_PORTS] = {0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x3FU, 0x1FU};
+
+/*
+ * Non AUTOSAR private function to write some bits of a register with one access
+ */
+STATIC void Port_writeMasked(volatile uint32 * Reg, uint32 Mask, uint32 FullMask, uint32 Value);
+
+#endif
+
+#if ((PORT_BATCHED_INIT == STD_ON) || (PORT_SCRUB_API == STD_ON) || (PORT_SET_PINS_CONFIG_API == STD_ON) ||\
+		(PORT_PROFILES_API == STD_ON) || (PORT_LOW_POWER_API == STD_ON))
 /*
- * Non AUTOSAR private function prototype to use it to get
- * the actual pin number in every port
+ * Non AUTOSAR private function to get the mask of the PMCx fields of some pins
  */
-STATIC Port_PinType Port_actualPinNumber(Port_name portNum, Port_PinType visual_pinNumber);
+STATIC uint32 Port_pctlMask(uint8 Pins);
+#endif
+
+#if (PORT_SET_PINS_CONFIG_API == STD_ON)
+/*
+ * Non AUTOSAR private function to validate one entry of Port_SetPinsConfig
+ */
+STATIC uint8 Port_checkPinConfig(const Port_PinConfigType * Entry);
+#endif
 
 /*******************************************************************************
  *                         Functions Definitions                                *
@@ -66,6 +263,11 @@ STATIC Port_PinType Port_actualPinNumber(Port_name portNum, Port_PinType visual_
  ************************************************************************************/
 void Port_Init( const Port_ConfigType* ConfigPtr )
 {
+#if (PORT_SCRUB_API == STD_ON)
+	/*local variable to use it as counter for the ports*/
+	uint8 port;
+#endif
+
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
 	/* check if the input configuration pointer is not a NULL_PTR */
@@ -95,7 +297,43 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
 		 * make the helper pointer to point at the passed structure to use it in the other functions
 		 */
 		g_Port_helperPtr = ConfigPtr;
+		g_Port_images = ConfigPtr->Images;
+
+#if (PORT_PROFILES_API == STD_ON)
+		/* Port_Init applies the configuration of the run profile */
+		g_Port_profile = PORT_PROFILE_RUN;
+#endif
+
+#if (PORT_LOW_POWER_API == STD_ON)
+		g_Port_lowPower = FALSE;
+		g_Port_gatedPorts = INITIAL_VALUE;
+#endif
+
+#if (PORT_REFRESH_ROUND_ROBIN == STD_ON)
+		/* start the round robin refresh from the first port */
+		g_Port_refreshNext = PORTA;
+#endif
+
+#if (PORT_SCRUB_API == STD_ON)
+		/* the expected images of the scrubber start from the configured register images */
+		for(port = INITIAL_VALUE; port < PORT_NUMBER_OF_PORTS; port++)
+		{
+			g_Port_expectedImages[port] = ConfigPtr->Images[port];
+		}
+#if (PORT_SCRUB_INCREMENTAL == STD_ON)
+		g_Port_scrubNext = INITIAL_VALUE;
+#endif
+#endif
+
+#if (PORT_AHB_PORTS_MASK != 0U)
+		/* move the selected ports to the AHB aperture before any access to their registers */
+		REG_SET_BITS(&SYSCTL_GPIOHBCTL_REG, PORT_AHB_PORTS_MASK);
+#endif
 
+#if (PORT_BATCHED_INIT == STD_ON)
+		/* apply the register images of the ports generated at compile time from the configuration */
+		Port_writeImages(ConfigPtr->Images);
+#else
 		/* point to the required Port Registers base address */
 		volatile uint32 * Port_Ptr = NULL_PTR;
 
@@ -123,11 +361,17 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
 		/*local variable to store the number of port*/
 		Port_name port_type;
 
+		/*local variable to store the ID of the pin*/
+		Port_PinType current_pinId;
+
+		/*local pointer to the location of the pin in the MCU*/
+		const Port_PinLocationType * location;
+
 		/*loop to move on all pins in the MCU and configure it one by one*/
 		for(counter = INITIAL_VALUE; counter < PORT_CONFIGURED_CHANNLES; counter++)
 		{
-			/*get the pin number from every structure in the array using the pointer*/
-			current_pinNumber =          ((ConfigPtr->Channels)[counter]).pin_num;
+			/*get the pin ID from every structure in the array using the pointer*/
+			current_pinId =              ((ConfigPtr->Channels)[counter]).pin_num;
 
 			/*get the direction from every structure in the array using the pointer*/
 			current_pinDirection =       ((ConfigPtr->Channels)[counter]).direction;
@@ -141,133 +385,30 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
 			/*get the initial value from every structure in the array using the pointer*/
 			current_initialValue =       ((ConfigPtr->Channels)[counter]).initial_value;
 
-			/*******************************************************************************
-			 *                                 PortA Pins                                  *
-			 *******************************************************************************/
-			if( (current_pinNumber >= PORTA_FIRST_PIN) &&
-					(current_pinNumber <= PORTA_END_PIN)
-			)
-			{
-				/*make the pointer to point at the PORTA base address as it PORTA pins range*/
-				Port_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-
-				/*make the port type to be PORTA as it is PORTA pins range*/
-				port_type = PORTA;
-			}/*End of PortA pins*/
-			/*******************************************************************************
-			 *                                 PortB Pins                                  *
-			 *******************************************************************************/
-			else if( (current_pinNumber >= PORTB_FIRST_PIN) &&
-					(current_pinNumber <= PORTB_END_PIN)
-			)
-			{
-				/*make the pointer to point at the PORTB base address as it PORTB pins range*/
-				Port_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-
-				/*make the port type to be PORTB as it is PORTB pins range*/
-				port_type = PORTB;
-
-			}/*End of PortB pins*/
-			/*******************************************************************************
-			 *                                 PortC Pins                                  *
-			 *******************************************************************************/
-			else if( (current_pinNumber >= PORTC_FIRST_PIN) &&
-					(current_pinNumber <= PORTC_END_PIN)
-			)
-			{
-				/*make the pointer to point at the PORTC base address as it PORTC pins range*/
-				Port_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-
-				/*make the port type to be PORTC as it is PORTC pins range*/
-				port_type = PORTC;
-			}/*End of PortC pins*/
-			/*******************************************************************************
-			 *                                 PortD Pins                                  *
-			 *******************************************************************************/
-			else if( (current_pinNumber >= PORTD_FIRST_PIN) &&
-					(current_pinNumber <= PORTD_END_PIN)
-			)
-			{
-				/*make the pointer to point at the PORTD base address as it PORTD pins range*/
-				Port_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-
-				/*make the port type to be PORTD as it is PORTD pins range*/
-				port_type = PORTD;
-
-			}/*End of PortD pins*/
-			/*******************************************************************************
-			 *                                 PortE Pins                                  *
-			 *******************************************************************************/
-			else if( (current_pinNumber >= PORTE_FIRST_PIN) &&
-					(current_pinNumber <= PORTE_END_PIN)
-			)
-			{
-				/*make the pointer to point at the PORTE base address as it PORTE pins range*/
-				Port_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-
-				/*make the port type to be PORTE as it is PORTE pins range*/
-				port_type = PORTE;
-
-			}/*End of PortE pins*/
-			/*******************************************************************************
-			 *                                 PortF Pins                                  *
-			 *******************************************************************************/
-			else if( (current_pinNumber >= PORTF_FIRST_PIN) &&
-					(current_pinNumber <= PORTF_END_PIN)
-			)
-			{
-				/*make the pointer to point at the PORTF base address as it PORTF pins range*/
-				Port_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-
-				/*make the port type to be PORTF as it is PORTF pins range*/
-				port_type = PORTF;
-
-			}/*End of PortF pins*/
-			else
-			{
-
-				/*...........No Action Required.........*/
-			}
-
-			/*
-			 * get the actual pin number in the port which is in range 0 & 7
-			 */
-			current_pinNumber = Port_actualPinNumber(port_type, current_pinNumber);
+			/* get the port, the registers base address and the actual pin number (0 ... 7) from the lookup table */
+			location = PORT_PIN_LOCATION(current_pinId);
+			Port_Ptr = location->Base;
+			port_type = (Port_name)location->Port;
+			current_pinNumber = location->Bit;
 
 			/******************************************************************************************
 			 *    Configure Pin stage after deciding in which port it belongs and point to this PORT   *
 			 ******************************************************************************************/
 			/* Enable clock for selected PORT*/
-			SET_BIT(SYSCTL_REGCGC2_REG, port_type);
+			REG_SET_BIT(&SYSCTL_REGCGC2_REG, port_type);
 
 			/*Allow time for clock to start*/
-			delay = SYSCTL_REGCGC2_REG;
+			delay = REG_READ32(&SYSCTL_REGCGC2_REG);
+			(void)delay;
 
 			/*Check if the Pin is PF0 or PD7 which requires a commit to be able to work with it*/
-			if( ((port_type == PORTD) && (current_pinNumber == PORTD_END_PIN-PORTD_FIRST_PIN)) ||
-					( ( port_type == PORTF) && (current_pinNumber == PORTF_FIRST_PIN-PORTF_FIRST_PIN) )
-			)
+			if(PORT_PIN_IS_LOCKED(current_pinId))
 			{
 				/* Unlock the GPIOCR register */
-				*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_LOCK_REG_OFFSET) = UNLOCK_VALUE;
+				REG_WRITE32(REG_ADDRESS(Port_Ptr, PORT_LOCK_REG_OFFSET), UNLOCK_VALUE);
 
 				/* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_COMMIT_REG_OFFSET) , current_pinNumber);
-			}
-			/*Check if the pin is belong to (PC0 to PC3) which is JTAG pins*/
-			else if( ( (port_type == PORTC) && (current_pinNumber == JTAG_PIN0) )||
-					( (port_type == PORTC) && (current_pinNumber == JTAG_PIN1) )||
-					( (port_type == PORTC) && (current_pinNumber == JTAG_PIN2) )||
-					( (port_type == PORTC) && (current_pinNumber == JTAG_PIN3) )
-			)
-			{
-				/* Do Nothing ...  this is the JTAG pins */
-
-				/*
-				 * Change the status of the JTAG flag to be HIGH to prevent accessing the registers
-				 *in this pins case
-				 */
-				g_JTAG_flag = STD_HIGH;
+				REG_SET_BIT(REG_ADDRESS(Port_Ptr, PORT_COMMIT_REG_OFFSET), current_pinNumber);
 			}
 			else
 			{
@@ -275,9 +416,8 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
 			}
 
 			/******************************************************************************************/
-			/*Check that the status of the JTAG flag is LOW to make sure
-			 * that the current pin is not belong to the JTAG pins*/
-			if (g_JTAG_flag == STD_LOW)
+			/* Check that the current pin is not one of the JTAG pins (PC0 to PC3), they are never configured */
+			if (!PORT_PIN_IS_JTAG(current_pinId))
 			{
 
 				/*******************************************************************************
@@ -288,7 +428,7 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
 
 				case PORT_PIN_IN:
 					/* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-					CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIR_REG_OFFSET) , current_pinNumber);
+					PORT_CLEAR_BIT(REG_ADDRESS(Port_Ptr, PORT_DIR_REG_OFFSET), current_pinNumber);
 
 					/*******************************************************************************
 					 *      Select the internal resistance mode of Pin  "if it is INPUT pin"       *
@@ -296,27 +436,27 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
 					if(current_pinResistor == PULL_UP)
 					{
 						/* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
-						SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_PULL_UP_REG_OFFSET) , current_pinNumber);
+						PORT_SET_BIT(REG_ADDRESS(Port_Ptr, PORT_PULL_UP_REG_OFFSET), current_pinNumber);
 					}
 					else if(current_pinResistor == PULL_DOWN)
 					{
 						/* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
-						SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_PULL_DOWN_REG_OFFSET) , current_pinNumber);
+						PORT_SET_BIT(REG_ADDRESS(Port_Ptr, PORT_PULL_DOWN_REG_OFFSET), current_pinNumber);
 					}
 					else
 					{
 						/* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-						CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_PULL_UP_REG_OFFSET) , current_pinNumber);
+						PORT_CLEAR_BIT(REG_ADDRESS(Port_Ptr, PORT_PULL_UP_REG_OFFSET), current_pinNumber);
 
 						/* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
-						CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_PULL_DOWN_REG_OFFSET) , current_pinNumber);
+						PORT_CLEAR_BIT(REG_ADDRESS(Port_Ptr, PORT_PULL_DOWN_REG_OFFSET), current_pinNumber);
 					}
 					break;
 
 				case PORT_PIN_OUT:
 
 					/* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-					SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIR_REG_OFFSET) , current_pinNumber);
+					PORT_SET_BIT(REG_ADDRESS(Port_Ptr, PORT_DIR_REG_OFFSET), current_pinNumber);
 
 					/*******************************************************************************
 					 *         Select the initial value of Pin  "if it is OUTPUT pin"              *
@@ -324,12 +464,12 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
 					if(current_initialValue == STD_HIGH)
 					{
 						/* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
-						SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DATA_REG_OFFSET) , current_pinDirection);
+						REG_SET_BIT(REG_ADDRESS(Port_Ptr, PORT_DATA_REG_OFFSET), current_pinNumber);
 					}
 					else
 					{
 						/* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
-						CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DATA_REG_OFFSET) , current_pinDirection);
+						REG_CLEAR_BIT(REG_ADDRESS(Port_Ptr, PORT_DATA_REG_OFFSET), current_pinNumber);
 					}
 					break;
 
@@ -346,54 +486,53 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
 				case PORT_PIN_MODE_DIO:
 
 					/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-					CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , current_pinNumber);
+					PORT_CLEAR_BIT(REG_ADDRESS(Port_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET), current_pinNumber);
 
 					/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-					SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , current_pinNumber);
+					PORT_SET_BIT(REG_ADDRESS(Port_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET), current_pinNumber);
 
 					/*Close the alternative function register by 0 as it is DIO mode*/
-					CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ALT_FUNC_REG_OFFSET) , current_pinNumber);
+					PORT_CLEAR_BIT(REG_ADDRESS(Port_Ptr, PORT_ALT_FUNC_REG_OFFSET), current_pinNumber);
 
 					/* Clear the PMCx bits for this pin */
-					*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_PCTL_REG_OFFSET) &= ~(0x0000000F << (current_pinNumber * BITS_NUMBER));
+					REG_UPDATE_FIELD32(REG_ADDRESS(Port_Ptr, PORT_PCTL_REG_OFFSET), 0x0000000FU << (current_pinNumber * BITS_NUMBER), INITIAL_VALUE);
 					break;
 
 				case PORT_PIN_MODE_ADC:
 
 					/* Set the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-					SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , current_pinNumber);
+					PORT_SET_BIT(REG_ADDRESS(Port_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET), current_pinNumber);
 
 					/* Clear the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-					CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , current_pinNumber);
+					PORT_CLEAR_BIT(REG_ADDRESS(Port_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET), current_pinNumber);
 
 					/*Open alternative function register by 1 as it is ADC mode*/
-					SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ALT_FUNC_REG_OFFSET) , current_pinNumber);
+					PORT_SET_BIT(REG_ADDRESS(Port_Ptr, PORT_ALT_FUNC_REG_OFFSET), current_pinNumber);
 
 					/*
 					 Clear the PMCx bits for this pin 
 				         it is the same mode number for DIO but it will work in ADC mode as PMCx bits for this pin is configured as analog pin
 					 */
-					*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_PCTL_REG_OFFSET) &= ~(0x0000000F << (current_pinNumber * BITS_NUMBER));
+					REG_UPDATE_FIELD32(REG_ADDRESS(Port_Ptr, PORT_PCTL_REG_OFFSET), 0x0000000FU << (current_pinNumber * BITS_NUMBER), INITIAL_VALUE);
 					break;
 
 				default:
 
-					/* Check if Pin Mode number is valid or not */
-					if ( ( (current_pinMode < MAXIMUM_MODE_NUMBER) ||
-							(current_pinMode == LAST_MODE_NUMBER) )
-					)
+					/* Check if Pin Mode number is valid or not (always valid in a validated configuration) */
+					if (PORT_CONFIG_MODE_IS_VALID(current_pinMode))
 					{
 						/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-						CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , current_pinNumber);
+						PORT_CLEAR_BIT(REG_ADDRESS(Port_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET), current_pinNumber);
 
 						/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-						SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , current_pinNumber);
+						PORT_SET_BIT(REG_ADDRESS(Port_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET), current_pinNumber);
 
 						/*Open alternative function register by 1 as it is any mode except DIO*/
-						SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ALT_FUNC_REG_OFFSET) , current_pinNumber);
+						PORT_SET_BIT(REG_ADDRESS(Port_Ptr, PORT_ALT_FUNC_REG_OFFSET), current_pinNumber);
 
 						/*Enter the mode number in the control register in PMCx bits for this pin*/
-						*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_PCTL_REG_OFFSET) |= (0x00000000 | (current_pinMode << (current_pinNumber * BITS_NUMBER)));
+						REG_UPDATE_FIELD32(REG_ADDRESS(Port_Ptr, PORT_PCTL_REG_OFFSET), 0x0000000FU << (current_pinNumber * BITS_NUMBER),
+								(uint32)current_pinMode << (current_pinNumber * BITS_NUMBER));
 					}
 					else
 					{
@@ -405,13 +544,12 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
 			}
 			else
 			{
-				/*
-				 * If the Status of JTAG flag is High change it to low status to enable the
-				 * operations in the registers for other pins in next iterations
-				 */
-				g_JTAG_flag = STD_LOW;
+				/* Do Nothing ...  this is the JTAG pins */
 			}
 		}/*End of for loop*/
+#endif
+
+		PORT_TRACE(PORT_INIT_SID, INITIAL_VALUE, INITIAL_VALUE);
 	}/*End of else configPtr == NULL_PTR*/
 }/*End of Port_Init Function*/
 /*************************************************************************************************************/
@@ -430,7 +568,9 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Sets the port pin direction
+ * Description: Sets the port pin direction. With PORT_BITBAND_ACCESS the direction bit
+ *              is written with one store to its bit-band alias, so the call does not race
+ *              with the interrupts which update other pins of the same port.
  ************************************************************************************/
 void Port_SetPinDirection( Port_PinType Pin, 
 		Port_PinDirectionType Direction
@@ -443,12 +583,8 @@ void Port_SetPinDirection( Port_PinType Pin,
 	 */
 	boolean setDirectionError = FALSE;
 
-	/* point to the required Port Registers base address */
-	volatile uint32 * Port_setDirectionPtr = NULL_PTR;
-
-	/*local variable to store the type of the port*/
-	Port_name port_number;
-
+	/*local pointer to the location of the pin in the MCU*/
+	const Port_PinLocationType * location;
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
@@ -471,23 +607,17 @@ void Port_SetPinDirection( Port_PinType Pin,
 		 */
 		setDirectionError = TRUE;
 	}
-	else
-	{
-		/* No Action Required */
-	}
-
-	/*Check if the pin configured as changeable or not*/
-	if( ( ((g_Port_helperPtr->Channels)[Pin]).directionChange) == directionChangable_OFF)
+	/*check the delivered pin ID is one of the MCU pins*/
+	else if( (Pin < PORTA_FIRST_PIN) || (Pin > PORTF_END_PIN) )
 	{
 		/*
 		 * report error that the passed pin number to the function
-		 * is configured as not changeable direction and the function
-		 * try to change its direction
+		 * is not one of the pins IDs of the MCU
 		 */
 		Det_ReportError(PORT_MODULE_ID,
 				PORT_INSTANCE_ID,
 				PORT_SET_PIN_DIRECTION_SID,
-				PORT_E_DIRECTION_UNCHANGEABLE
+				PORT_E_PARAM_PIN
 		);
 
 		/*
@@ -495,26 +625,20 @@ void Port_SetPinDirection( Port_PinType Pin,
 		 * the function form doing any thing if Det error reported
 		 */
 		setDirectionError = TRUE;
-
-	}
-	else
-	{
-		/*............. No Action Required........... */
-
 	}
-
-	/*check the number of the deliver pin greater than the total number of pins or not*/
-	if( Pin >= PORT_CONFIGURED_CHANNLES )
+	/*Check if the pin configured as changeable or not (the JTAG pins are never changeable)*/
+	else if( ((g_Port_images[PORT_PIN_LOCATION(Pin)->Port].DirChangeable) &
+			(1U << PORT_PIN_LOCATION(Pin)->Bit)) == INITIAL_VALUE )
 	{
 		/*
 		 * report error that the passed pin number to the function
-		 * is grater than the configured pins number
-		 * is greater than the total pin numbers in the MCU
+		 * is configured as not changeable direction and the function
+		 * try to change its direction
 		 */
 		Det_ReportError(PORT_MODULE_ID,
 				PORT_INSTANCE_ID,
 				PORT_SET_PIN_DIRECTION_SID,
-				PORT_E_PARAM_PIN
+				PORT_E_DIRECTION_UNCHANGEABLE
 		);
 
 		/*
@@ -522,150 +646,55 @@ void Port_SetPinDirection( Port_PinType Pin,
 		 * the function form doing any thing if Det error reported
 		 */
 		setDirectionError = TRUE;
-
 	}
 	else
 	{
 		/*........No Action Required.......*/
-
 	}
 
 #endif
 
+#if (PORT_LOW_POWER_API == STD_ON)
+	/* the pins are parked and their ports may be gated until Port_ExitLowPower */
+	if ((FALSE == setDirectionError) && (TRUE == g_Port_lowPower))
+	{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_SET_PIN_DIRECTION_SID,
+				PORT_E_POWER_STATE
+		);
+#endif
+		setDirectionError = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
 	/*Check the status of the error to make sure there is no Det error occurs*/
 	if(FALSE == setDirectionError)
 	{
+		/* get the registers base address and the actual pin number (0 ... 7) from the lookup table */
+		location = PORT_PIN_LOCATION(Pin);
 
-		/*******************************************************************************
-		 *                                 PortA Pins                                  *
-		 *******************************************************************************/
-		if( (Pin >= PORTA_FIRST_PIN) &&
-				(Pin <= PORTA_END_PIN)
-		)
-		{
-			/*make the pointer to point at the PORTA base address as it PORTA pins range*/
-			Port_setDirectionPtr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-
-			/*make the port type to be PORTA as it is PORTA pins range*/
-			port_number = PORTA;
-
-		}/*End of PortA pins*/
-		/*******************************************************************************
-		 *                                 PortB Pins                                  *
-		 *******************************************************************************/
-		else if( (Pin >= PORTB_FIRST_PIN) &&
-				(Pin <= PORTB_END_PIN)
-		)
-		{
-			/*make the pointer to point at the PORTB base address as it PORTB pins range*/
-			Port_setDirectionPtr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-
-			/*make the port type to be PORTB as it is PORTB pins range*/
-			port_number = PORTB;
-
-
-		}/*End of PortB pins*/
-		/*******************************************************************************
-		 *                                 PortC Pins                                  *
-		 *******************************************************************************/
-		else if( (Pin >= PORTC_FIRST_PIN) &&
-				(Pin <= PORTC_END_PIN)
-		)
+		if(PORT_PIN_IS_JTAG(Pin))
 		{
-			/*make the pointer to point at the PORTC base address as it PORTC pins range*/
-			Port_setDirectionPtr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-
-			/*make the port type to be PORTC as it is PORTC pins range*/
-			port_number = PORTC;
-
-		}/*End of PortC pins*/
-		/*******************************************************************************
-		 *                                 PortD Pins                                  *
-		 *******************************************************************************/
-		else if( (Pin >= PORTD_FIRST_PIN) &&
-				(Pin <= PORTD_END_PIN)
-		)
-		{
-			/*make the pointer to point at the PORTD base address as it PORTD pins range*/
-			Port_setDirectionPtr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-
-			/*make the port type to be PORTD as it is PORTD pins range*/
-			port_number = PORTD;
-
-		}/*End of PortD pins*/
-		/*******************************************************************************
-		 *                                 PortE Pins                                  *
-		 *******************************************************************************/
-		else if( (Pin >= PORTE_FIRST_PIN) &&
-				(Pin <= PORTE_END_PIN)
-		)
-		{
-			/*make the pointer to point at the PORTE base address as it PORTE pins range*/
-			Port_setDirectionPtr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-
-			/*make the port type to be PORTE as it is PORTE pins range*/
-			port_number = PORTE;
-
-		}/*End of PortE pins*/
-		/*******************************************************************************
-		 *                                 PortF Pins                                  *
-		 *******************************************************************************/
-		else if( (Pin >= PORTF_FIRST_PIN) &&
-				(Pin <= PORTF_END_PIN)
-		)
-		{
-			/*make the pointer to point at the PORTF base address as it PORTF pins range*/
-			Port_setDirectionPtr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-
-			/*make the port type to be PORTF as it is PORTF pins range*/
-			port_number = PORTF;
-
-		}/*End of PortF pins*/
-		else
-		{
-			/*.......Do Nothing......*/
+			/* Do Nothing ...  this is the JTAG pins */
 		}
-		/**********************************************************************************/
-
-		/*
-		 * get the actual pin number in the port which is in range 0 & 7
-		 */
-		Pin = Port_actualPinNumber(port_number, Pin);
-
-		if( ( (port_number == PORTC) && (Pin == JTAG_PIN0) )||
-				( (port_number == PORTC) && (Pin == JTAG_PIN1) )||
-				( (port_number == PORTC) && (Pin == JTAG_PIN2) )||
-				( (port_number == PORTC) && (Pin == JTAG_PIN3) )
-		)
+		else if(PORT_PIN_OUT == Direction)
 		{
-			/* Do Nothing and exit from the function...  this is the JTAG pins */
-			return;
+			/* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+			PORT_SET_BIT(REG_ADDRESS(location->Base, PORT_DIR_REG_OFFSET), location->Bit);
 		}
 		else
 		{
-			/*******************************************************************************
-			 *                       Select the direction of Pin                           *
-			 *******************************************************************************/
-			switch(Direction)
-			{
-
-			case PORT_PIN_IN:
-
-				/* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_setDirectionPtr + PORT_DIR_REG_OFFSET) , Pin);
-				break;
-
-			case PORT_PIN_OUT:
-
-				/* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_setDirectionPtr + PORT_DIR_REG_OFFSET) , Pin);
-				break;
-
-			default:
-				/* Do Nothing */
-				break;
-			}/*End of Switch direction*/
+			/* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
+			PORT_CLEAR_BIT(REG_ADDRESS(location->Base, PORT_DIR_REG_OFFSET), location->Bit);
 		}
+
+		PORT_TRACE(PORT_SET_PIN_DIRECTION_SID, Pin, Direction);
 	}/*end of error = false*/
 	else
 	{
@@ -692,24 +721,9 @@ void Port_RefreshPortDirection( void )
 	 */
 	boolean refreshError = FALSE;
 
-	/*local variable to store the number of pin in the port*/
-	uint8 currentPinNumber;
-
-	/*local variable to store the number of port*/
-	Port_name portType;
-
 	/*local variable to use it as counter for the loop*/
 	uint8 loopCounter;
 
-	/*local variable to store the direction of pin in the port*/
-	Port_PinDirectionType currentPinDirection;
-
-	/*pointer to store the mode of direction changeability for the pin*/
-	Pin_directionChangeable direction_change;
-
-	/* point to the required Port Registers base address */
-	volatile uint32 * Port_refreshDirectionPtr = NULL_PTR;
-
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
 	/* check if PORT Driver is Initialized */
@@ -736,186 +750,51 @@ void Port_RefreshPortDirection( void )
 	}
 #endif
 
+#if (PORT_LOW_POWER_API == STD_ON)
+	/* the parked pins are not refreshed and the gated ports are not accessed until Port_ExitLowPower */
+	if (TRUE == g_Port_lowPower)
+	{
+		refreshError = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
 	/*Check the status of the error to make sure there is no Det error occurs*/
 	if(FALSE == refreshError )
 	{
-		/*loop to move on all pins in the MCU and refresh very pin it one by one*/
-		for(loopCounter = INITIAL_VALUE ; loopCounter < PORT_CONFIGURED_CHANNLES; loopCounter++ )
+#if (PORT_REFRESH_ROUND_ROBIN == STD_ON)
+		/*
+		 * refresh one port per call to bound the time of the call,
+		 * the ports without direction unchangeable pins are skipped without any register access
+		 */
+		for(loopCounter = INITIAL_VALUE ; loopCounter < PORT_NUMBER_OF_PORTS; loopCounter++ )
 		{
-			/*get the pin number from every structure in the array using the pointer*/
-			currentPinNumber =     ((g_Port_helperPtr->Channels)[loopCounter]).pin_num;
-
-			/*get the direction from every structure in the array using the pointer*/
-			currentPinDirection =  ((g_Port_helperPtr->Channels)[loopCounter]).direction;
-
-			/*get the direction change mode from every structure in the array using the pointer*/
-			direction_change =     ((g_Port_helperPtr->Channels)[loopCounter]).directionChange;
-
-			/*******************************************************************************
-			 *                                 PortA Pins                                  *
-			 *******************************************************************************/
-			if( (currentPinNumber >= PORTA_FIRST_PIN) &&
-					(currentPinNumber <= PORTA_END_PIN)
-			)
-			{
-				/*make the pointer to point at the PORTA base address as it PORTA pins range*/
-				Port_refreshDirectionPtr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-
-				/*make the port type to be PORTA as it is PORTA pins range*/
-				portType = PORTA;
-
-			}/*End of PortA pins*/
-			/*******************************************************************************
-			 *                                 PortB Pins                                  *
-			 *******************************************************************************/
-			else if( (currentPinNumber >= PORTB_FIRST_PIN) &&
-					(currentPinNumber <= PORTB_END_PIN)
-			)
-			{
-				/*make the pointer to point at the PORTB base address as it PORTB pins range*/
-				Port_refreshDirectionPtr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-
-				/*make the port type to be PORTB as it is PORTB pins range*/
-				portType = PORTB;
-
-			}/*End of PortB pins*/
-			/*******************************************************************************
-			 *                                 PortC Pins                                  *
-			 *******************************************************************************/
-			else if( (currentPinNumber >= PORTC_FIRST_PIN) &&
-					(currentPinNumber <= PORTC_END_PIN)
-			)
-			{
-				/*make the pointer to point at the PORTC base address as it PORTC pins range*/
-				Port_refreshDirectionPtr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-
-				/*make the port type to be PORTC as it is PORTC pins range*/
-				portType = PORTC;
-
-			}/*End of PortC pins*/
-			/*******************************************************************************
-			 *                                 PortD Pins                                  *
-			 *******************************************************************************/
-			else if( (currentPinNumber >= PORTD_FIRST_PIN) &&
-					(currentPinNumber <= PORTD_END_PIN)
-			)
-			{
-				/*make the pointer to point at the PORTD base address as it PORTD pins range*/
-				Port_refreshDirectionPtr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-
-				/*make the port type to be PORTD as it is PORTD pins range*/
-				portType = PORTD;
-
-			}/*End of PortD pins*/
-			/*******************************************************************************
-			 *                                 PortE Pins                                  *
-			 *******************************************************************************/
-			else if( (currentPinNumber >= PORTE_FIRST_PIN) &&
-					(currentPinNumber <= PORTE_END_PIN)
-			)
-			{
-				/*make the pointer to point at the PORTE base address as it PORTE pins range*/
-				Port_refreshDirectionPtr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-
-				/*make the port type to be PORTE as it is PORTE pins range*/
-				portType = PORTE;
-
-			}/*End of PortE pins*/
-			/*******************************************************************************
-			 *                                 PortF Pins                                  *
-			 *******************************************************************************/
-			else if( (currentPinNumber >= PORTF_FIRST_PIN) &&
-					(currentPinNumber <= PORTF_END_PIN)
-			)
+			if( ((g_Port_images[g_Port_refreshNext].Pins) &
+					(uint8)(~(g_Port_images[g_Port_refreshNext].DirChangeable))) != INITIAL_VALUE )
 			{
-				/*make the pointer to point at the PORTF base address as it PORTF pins range*/
-				Port_refreshDirectionPtr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-
-				/*make the port type to be PORTF as it is PORTF pins range*/
-				portType = PORTF;
-
-			}/*End of PortF pins*/
-			else
-			{
-
-			}
-			/****************************************************************************/
-
-			/*
-			 * get the actual pin number in the port which is in range 0 & 7
-			 */
-			currentPinNumber = Port_actualPinNumber(portType, currentPinNumber);
-
-			if( ( (portType == PORTC) && (currentPinNumber == JTAG_PIN0) )||
-					( (portType == PORTC) && (currentPinNumber == JTAG_PIN1) )||
-					( (portType == PORTC) && (currentPinNumber == JTAG_PIN2) )||
-					( (portType == PORTC) && (currentPinNumber == JTAG_PIN3) )
-			)
-			{
-				/* Do Nothing ...  this is the JTAG pins */
-
-				/*
-				 * Change the status of the JTAG flag to be HIGH to prevent accessing the registers
-				 *in this pins case
-				 */
-				g_JTAG_flag = STD_HIGH;
+				Port_refreshPort(g_Port_refreshNext);
+				loopCounter = PORT_NUMBER_OF_PORTS;
 			}
 			else
 			{
-				/* Do Nothing ... No need to unlock the commit register for this pin */
-			}
-
-			if (g_JTAG_flag == STD_LOW)
-			{
-
-				if( direction_change == directionChangable_OFF )
-				{
-					/*******************************************************************************
-					 *                       Select the direction of Pin                           *
-					 *******************************************************************************/
-					switch(currentPinDirection)
-					{
-					case PORT_PIN_OUT:
-
-						/* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-						SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_refreshDirectionPtr + PORT_DIR_REG_OFFSET) , currentPinNumber);
-						break;
-
-					case PORT_PIN_IN:
-
-						/* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-						CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_refreshDirectionPtr + PORT_DIR_REG_OFFSET) , currentPinNumber);
-						break;
-
-					default:
-						/* Do Nothing */
-						break;
-					}/*End of Switch direction*/
-
-				}
-				else
-				{
-					/*.....No action Required.....*/
-
-					/*
-					 * The function Port_RefreshPortDirection shall exclude those port pins from
-					 *refreshing that are configured as "pin direction changeable during runtime"
-					 */
-				}
-
-
-			}
-			else
-			{
-				/*
-				 * If the Status of JTAG flag is High change it to low status to enable the
-				 * operations in the registers for other pins in next iterations
-				 */
-				g_JTAG_flag = STD_LOW;
+				/*.....No action Required.....*/
 			}
 
+			/* move to the next port */
+			g_Port_refreshNext = (g_Port_refreshNext + 1U) % PORT_NUMBER_OF_PORTS;
+		}
+#else
+		/*loop to move on all ports in the MCU and refresh the direction of every port at once*/
+		for(loopCounter = INITIAL_VALUE ; loopCounter < PORT_NUMBER_OF_PORTS; loopCounter++ )
+		{
+			Port_refreshPort(loopCounter);
 		}/*End of for loop*/
+#endif
 
+		PORT_TRACE(PORT_REFRESH_PORT_DIRECTION_SID, INITIAL_VALUE, INITIAL_VALUE);
 	}/*end of refreshError = false */
 	else
 	{
@@ -1016,6 +895,8 @@ void Port_GetVersionInfo( Std_VersionInfoType* versioninfo )
 
 		/* Copy Software Patch Version */
 		versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+
+		PORT_TRACE(PORT_GET_VERSION_INFO_SID, INITIAL_VALUE, INITIAL_VALUE);
 	}
 	else
 	{
@@ -1040,7 +921,10 @@ void Port_GetVersionInfo( Std_VersionInfoType* versioninfo )
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Sets the port pin mode.
+ * Description: Sets the port pin mode. With PORT_BITBAND_ACCESS the GPIOAMSEL, GPIODEN
+ *              and GPIOAFSEL bits are written through their bit-band aliases, the 4-bit
+ *              field of the pin in GPIOPCTL is written with an exclusive (LDREX / STREX)
+ *              update, so the call does not mask the interrupts.
  ************************************************************************************/
 void Port_SetPinMode( Port_PinType Pin, 
 		Port_PinModeType Mode
@@ -1052,11 +936,8 @@ void Port_SetPinMode( Port_PinType Pin,
 	 */
 	boolean setModeError = FALSE;
 
-	/* point to the required Port Registers base address */
-	volatile uint32 * Port_setModePtr = NULL_PTR;
-
-	/*local variable to store the number of the port*/
-	Port_name typeOfPort;
+	/*local pointer to the location of the pin in the MCU*/
+	const Port_PinLocationType * location;
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
@@ -1078,69 +959,47 @@ void Port_SetPinMode( Port_PinType Pin,
 		 */
 		setModeError = TRUE;
 	}
-	else
-	{
-		/* No Action Required */
-	}
-
-	/*Check if the pin configured as mode changeable or not*/
-	if( ( ((g_Port_helperPtr->Channels)[Pin]).modeChange) == modeChangable_OFF)
+	/*check the delivered pin ID is one of the MCU pins*/
+	else if( (Pin < PORTA_FIRST_PIN) || (Pin > PORTF_END_PIN) )
 	{
 		/*
 		 * report error that the passed pin number to the function
-		 * is configured as not changeable mode and the function
-		 * try to change its mode
+		 * is not one of the pins IDs of the MCU
 		 */
 		Det_ReportError(PORT_MODULE_ID,
 				PORT_INSTANCE_ID,
 				PORT_SET_PIN_MODE_SID,
-				PORT_E_MODE_UNCHANGEABLE
+				PORT_E_PARAM_PIN
 		);
+
 		/*
 		 * Change the status of the error to be true to prevent
 		 * the function form doing any thing if Det error reported
 		 */
 		setModeError = TRUE;
-
-	}
-	else
-	{
-		/*..........No Action Required...........*/
-
 	}
-
-	/*check the number of the deliver pin greater than the total number of pins or not*/
-	if( Pin >= PORT_CONFIGURED_CHANNLES )
+	/*Check if the pin configured as mode changeable or not (the JTAG pins are never changeable)*/
+	else if( ((g_Port_images[PORT_PIN_LOCATION(Pin)->Port].ModeChangeable) &
+			(1U << PORT_PIN_LOCATION(Pin)->Bit)) == INITIAL_VALUE )
 	{
 		/*
 		 * report error that the passed pin number to the function
-		 * is grater than the configured pins number
-		 * is greater than the total pin numbers in the MCU
+		 * is configured as not changeable mode and the function
+		 * try to change its mode
 		 */
 		Det_ReportError(PORT_MODULE_ID,
 				PORT_INSTANCE_ID,
 				PORT_SET_PIN_MODE_SID,
-				PORT_E_PARAM_PIN
+				PORT_E_MODE_UNCHANGEABLE
 		);
-
 		/*
 		 * Change the status of the error to be true to prevent
 		 * the function form doing any thing if Det error reported
 		 */
 		setModeError = TRUE;
-
-	}
-	else
-	{
-		/* No Action Required */
-
 	}
-
 	/* Check if Pin Mode number is valid or not */
-	if ( (Mode > MAXIMUM_MODE_NUMBER) &&
-			(Mode != LAST_MODE_NUMBER) &&
-			(Mode != PORT_PIN_MODE_ADC)
-	)
+	else if (!PORT_MODE_IS_VALID(Mode))
 	{
 		/*
 		 * report the error that the delivered mode number
@@ -1158,7 +1017,6 @@ void Port_SetPinMode( Port_PinType Pin,
 		 */
 		setModeError = TRUE;
 	}
-
 	else
 	{
 		/* No Action Required */
@@ -1166,116 +1024,45 @@ void Port_SetPinMode( Port_PinType Pin,
 
 #endif
 
+#if (PORT_LOW_POWER_API == STD_ON)
+	/* the pins are parked and their ports may be gated until Port_ExitLowPower */
+	if ((FALSE == setModeError) && (TRUE == g_Port_lowPower))
+	{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_SET_PIN_MODE_SID,
+				PORT_E_POWER_STATE
+		);
+#endif
+		setModeError = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
 	/*Check the status of the error to make sure there is no Det error occurs*/
 	if(FALSE == setModeError)
 	{
-		/*******************************************************************************
-		 *                                 PortA Pins                                  *
-		 *******************************************************************************/
-		if( (Pin >= PORTA_FIRST_PIN) &&
-				(Pin <= PORTA_END_PIN)
-		)
-		{
-			/*make the pointer to point at the PORTA base address as it PORTA pins range*/
-			Port_setModePtr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-
-			/*make the port type to be PORTA as it is PORTA pins range*/
-			typeOfPort = PORTA;
-
-		}/*End of PortA pins*/
-		/*******************************************************************************
-		 *                                 PortB Pins                                  *
-		 *******************************************************************************/
-		else if( (Pin >= PORTB_FIRST_PIN) &&
-				(Pin <= PORTB_END_PIN)
-		)
-		{
-			/*make the pointer to point at the PORTB base address as it PORTB pins range*/
-			Port_setModePtr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-
-			/*make the port type to be PORTB as it is PORTB pins range*/
-			typeOfPort = PORTB;
-
-		}/*End of PortB pins*/
-		/*******************************************************************************
-		 *                                 PortC Pins                                  *
-		 *******************************************************************************/
-		else if( (Pin >= PORTC_FIRST_PIN) &&
-				(Pin <= PORTC_END_PIN)
-		)
-		{
-			/*make the pointer to point at the PORTC base address as it PORTC pins range*/
-			Port_setModePtr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-
-			/*make the port type to be PORTC as it is PORTC pins range*/
-			typeOfPort = PORTC;
-
-		}/*End of PortC pins*/
-		/*******************************************************************************
-		 *                                 PortD Pins                                  *
-		 *******************************************************************************/
-		else if( (Pin >= PORTD_FIRST_PIN) &&
-				(Pin <= PORTD_END_PIN)
-		)
-		{
-			/*make the pointer to point at the PORTD base address as it PORTD pins range*/
-			Port_setModePtr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-
-			/*make the port type to be PORTD as it is PORTD pins range*/
-			typeOfPort = PORTD;
-
-		}/*End of PortD pins*/
-		/*******************************************************************************
-		 *                                 PortE Pins                                  *
-		 *******************************************************************************/
-		else if( (Pin >= PORTE_FIRST_PIN) &&
-				(Pin <= PORTE_END_PIN)
-		)
-		{
-			/*make the pointer to point at the PORTE base address as it PORTE pins range*/
-			Port_setModePtr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-
-			/*make the port type to be PORTE as it is PORTE pins range*/
-			typeOfPort = PORTE;
-
-		}/*End of PortE pins*/
-		/*******************************************************************************
-		 *                                 PortF Pins                                  *
-		 *******************************************************************************/
-		else if( (Pin >= PORTF_FIRST_PIN) &&
-				(Pin <= PORTF_END_PIN)
-		)
-		{
-			/*make the pointer to point at the PORTF base address as it PORTF pins range*/
-			Port_setModePtr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-
-			/*make the port type to be PORTF as it is PORTF pins range*/
-			typeOfPort = PORTF;
-
-		}/*End of PortF pins*/
-		else
-		{
-			/*.......Do Nothing......*/
-		}
-		/**********************************************************************************/
-
-		/*
-		 * get the actual pin number in the port which is in range 0 & 7
-		 */
-		Pin = Port_actualPinNumber(typeOfPort, Pin);
+		/* get the registers base address and the actual pin number (0 ... 7) from the lookup table */
+		location = PORT_PIN_LOCATION(Pin);
 
 		/*Check if the pin is belong to (PC0 to PC3) which is JTAG pins*/
-		if( ( (typeOfPort == PORTC) && (Pin == JTAG_PIN0) )||
-				( (typeOfPort == PORTC) && (Pin == JTAG_PIN1) )||
-				( (typeOfPort == PORTC) && (Pin == JTAG_PIN2) )||
-				( (typeOfPort == PORTC) && (Pin == JTAG_PIN3) )
-		)
+		if(PORT_PIN_IS_JTAG(Pin))
 		{
-			/* Do Nothing and exit from the function...  this is the JTAG pins */
-			return;
+			/* Do Nothing ...  this is the JTAG pins */
 		}
 		else
 		{
+			/*
+			 * Write the PMCx bits of this pin with one exclusive update (no lost update of the other pins of the port):
+			 * 0 for DIO and ADC (the ADC pin is configured as analog pin), the mode number otherwise
+			 */
+			REG_UPDATE_FIELD32(REG_ADDRESS(location->Base, PORT_PCTL_REG_OFFSET), PORT_PCTL_PIN_MASK << (location->Bit * BITS_NUMBER),
+					(((PORT_PIN_MODE_DIO == Mode) || (PORT_PIN_MODE_ADC == Mode)) ? INITIAL_VALUE : (uint32)Mode) << (location->Bit * BITS_NUMBER));
+
 			/*******************************************************************************
 			 *                         Select the mode of Pin                              *
 			 *******************************************************************************/
@@ -1284,55 +1071,50 @@ void Port_SetPinMode( Port_PinType Pin,
 			case PORT_PIN_MODE_DIO:
 
 				/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Pin);
+				PORT_CLEAR_BIT(REG_ADDRESS(location->Base, PORT_ANALOG_MODE_SEL_REG_OFFSET), location->Bit);
 
 				/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Pin);
+				PORT_SET_BIT(REG_ADDRESS(location->Base, PORT_DIGITAL_ENABLE_REG_OFFSET), location->Bit);
 
 				/*Close the alternative function register by 0 as it is DIO mode*/
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_ALT_FUNC_REG_OFFSET) , Pin);
-
-				/* Clear the PMCx bits for this pin */
-				*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_PCTL_REG_OFFSET) &= ~(0x0000000F << (Pin * BITS_NUMBER));
+				PORT_CLEAR_BIT(REG_ADDRESS(location->Base, PORT_ALT_FUNC_REG_OFFSET), location->Bit);
 				break;
 
 			case PORT_PIN_MODE_ADC:
 
-				/* Set the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Pin);
+				/* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
+				PORT_SET_BIT(REG_ADDRESS(location->Base, PORT_ANALOG_MODE_SEL_REG_OFFSET), location->Bit);
 
-				/* Clear the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Pin);
-
-				/*Open alternative function register by 1 as it is ADC mode*/
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_ALT_FUNC_REG_OFFSET) , Pin);
+				/* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
+				PORT_CLEAR_BIT(REG_ADDRESS(location->Base, PORT_DIGITAL_ENABLE_REG_OFFSET), location->Bit);
 
 				/*
-			         Clear the PMCx bits for this pin 
-				 it is the same mode number for DIO but it will work in ADC mode as PMCx bits for this pin is configured as analog pin
-				*/
-				*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_PCTL_REG_OFFSET) &= ~(0x0000000F << (Pin * BITS_NUMBER));
+				 * Open alternative function register by 1 as it is ADC mode,
+				 * the PMCx bits stay cleared as the pin is configured as analog pin
+				 */
+				PORT_SET_BIT(REG_ADDRESS(location->Base, PORT_ALT_FUNC_REG_OFFSET), location->Bit);
 				break;
 
 			default:
 
 				/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Pin);
+				PORT_CLEAR_BIT(REG_ADDRESS(location->Base, PORT_ANALOG_MODE_SEL_REG_OFFSET), location->Bit);
 
 				/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Pin);
+				PORT_SET_BIT(REG_ADDRESS(location->Base, PORT_DIGITAL_ENABLE_REG_OFFSET), location->Bit);
 
 				/*Open alternative function register by 1 as it is any mode except DIO*/
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_ALT_FUNC_REG_OFFSET) , Pin);
-
-				/*Enter the mode number in the control register in PMCx bits for this pin*/
-				*(volatile uint32 *)((volatile uint8 *)Port_setModePtr + PORT_PCTL_REG_OFFSET) |= (0x00000000 + (Mode << (Pin * BITS_NUMBER)));
+				PORT_SET_BIT(REG_ADDRESS(location->Base, PORT_ALT_FUNC_REG_OFFSET), location->Bit);
 				break;
 			}/*End of switch mode*/
 
+#if (PORT_SCRUB_API == STD_ON)
+			/* keep the expected image of the scrubber up to date with the new mode of the pin */
+			Port_imageSetMode(&g_Port_expectedImages[location->Port], location->Bit, Mode);
+#endif
 		}
 
-
+		PORT_TRACE(PORT_SET_PIN_MODE_SID, Pin, Mode);
 	}/*end of error = false*/
 	else
 	{
@@ -1342,86 +1124,1202 @@ void Port_SetPinMode( Port_PinType Pin,
 }/*End of Port_SetPinMode Function*/
 #endif
 
-/************************************************************************************************
- * Function Name: Port_actualPinNumber
+#if (PORT_SCRUB_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_ScrubRegisters
  * Sync/Async: Synchronous
- * Reentrancy: Reentrant
- * Parameters (in): - portNum : Pointer to post-build configuration data set
- *                  - visual_pinNumber : carry the passed pin number in configuration structure
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  None
  * Parameters (inout): None
  * Parameters (out): None
- * Return value:    - Port_PinType : the actual pin number in the port
- * Description: Return the actual number of the pin according to Port
- *************************************************************************************************/
-STATIC Port_PinType Port_actualPinNumber(Port_name portNum, Port_PinType visual_pinNumber)
+ * Return value: None
+ * Description: Compares GPIODEN, GPIOAFSEL, GPIOAMSEL, GPIOPUR, GPIOPDR and GPIOPCTL of the
+ *              configured pins with the expected image of every port and restores only the
+ *              drifted registers (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+void Port_ScrubRegisters( void )
 {
+	/*
+	 * local variable to store the status of Port_ScrubRegisters
+	 * if it has Det error or not and prevent the function from work
+	 */
+	boolean scrubError = FALSE;
 
-	/*local variable to store the actual pin number according to each PORT*/
-	Port_PinType pin_number = INITIAL_VALUE;
+	/*local variable to use it as counter for the loop*/
+	uint8 loopCounter;
 
-	switch(portNum)
-	{
+#if (PORT_SCRUB_INCREMENTAL == STD_ON)
+	/*local variable to count the registers checked in this call*/
+	uint8 checked = INITIAL_VALUE;
+#else
+	/*local variable to use it as counter for the registers of the port*/
+	uint8 reg;
+#endif
 
-	case PORTA:
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
 
+	/* check if PORT Driver is Initialized */
+	if (PORT_NOT_INITIALIZED == g_Port_Status)
+	{
 		/*
-		 * Calculate the actual pin number in portA by removing the  (8 (no of pins per port) * Port number)
-		 * which equals to PORTA first pin
+		 * report error that the Port driver not initialized
+		 * which means the PORT_Init function is not be called
 		 */
-		pin_number = visual_pinNumber - PORTA_FIRST_PIN;
-		break;
-
-	case PORTB:
-
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_SCRUB_REGISTERS_SID,
+				PORT_E_UNINIT
+		);
 		/*
-		 * Calculate the actual pin number in portB by removing the  (8 (no of pins per port) * Port number)
-		 * which equals to PORTB first pin
+		 * Change the status of the error to be true to prevent
+		 * the function form doing any thing if Det error reported
 		 */
-		pin_number = visual_pinNumber - PORTB_FIRST_PIN;
-		break;
+		scrubError = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
 
-	case PORTC:
+#if (PORT_LOW_POWER_API == STD_ON)
+	/* the parked pins are not restored and the gated ports are not accessed until Port_ExitLowPower */
+	if (TRUE == g_Port_lowPower)
+	{
+		scrubError = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
 
+	/*Check the status of the error to make sure there is no Det error occurs*/
+	if(FALSE == scrubError)
+	{
+#if (PORT_SCRUB_INCREMENTAL == STD_ON)
 		/*
-		 * Calculate the actual pin number in portC by removing the  (8 (no of pins per port) * Port number)
-		 * which equals to PORTC first pin
+		 * check the next slice of registers, the registers of the not configured
+		 * ports are skipped without any register access and are not counted in the slice
 		 */
-		pin_number = visual_pinNumber - PORTC_FIRST_PIN;
-		break;
+		for(loopCounter = INITIAL_VALUE;
+				(loopCounter < (PORT_NUMBER_OF_PORTS * PORT_SCRUB_REGISTERS)) && (checked < PORT_SCRUB_SLICE_REGISTERS);
+				loopCounter++)
+		{
+			if(TRUE == Port_scrubRegister(g_Port_scrubNext / PORT_SCRUB_REGISTERS, g_Port_scrubNext % PORT_SCRUB_REGISTERS))
+			{
+				checked++;
+			}
+			else
+			{
+				/* No Action Required */
+			}
 
-	case PORTD:
+			/* move to the next register, a complete pass ends after the last register of the last port */
+			g_Port_scrubNext++;
+			if(g_Port_scrubNext == (PORT_NUMBER_OF_PORTS * PORT_SCRUB_REGISTERS))
+			{
+				g_Port_scrubNext = INITIAL_VALUE;
+				g_Port_scrubCounters.Passes++;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+#else
+		/*loop to move on all the ports and check all their registers*/
+		for(loopCounter = INITIAL_VALUE; loopCounter < PORT_NUMBER_OF_PORTS; loopCounter++)
+		{
+			for(reg = INITIAL_VALUE; reg < PORT_SCRUB_REGISTERS; reg++)
+			{
+				(void)Port_scrubRegister(loopCounter, reg);
+			}
+		}
+		g_Port_scrubCounters.Passes++;
+#endif
 
-		/*
-		 * Calculate the actual pin number in portD by removing the  (8 (no of pins per port) * Port number)
-		 * which equals to PORTD first pin
-		 */
-		pin_number = visual_pinNumber - PORTD_FIRST_PIN;
-		break;
+		PORT_TRACE(PORT_SCRUB_REGISTERS_SID, INITIAL_VALUE, g_Port_scrubCounters.Passes);
+	}
+	else
+	{
+		/*..........No Action Needed.........*/
+	}
+}/*End of Port_ScrubRegisters Function*/
 
-	case PORTE:
+/************************************************************************************
+ * Service Name: Port_GetScrubCounters
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  None
+ * Parameters (inout): None
+ * Parameters (out): Counters - Pointer to where to store the counters of the scrubber
+ * Return value: None
+ * Description: Returns the passes and the drift counters of the register scrubber
+ *              (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+void Port_GetScrubCounters( Port_ScrubCountersType* Counters )
+{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
 
-		/*
-		 * Calculate the actual pin number in portE by removing the  (8 (no of pins per port) * Port number)
-		 * which equals to PORTE first pin
-		 */
-		pin_number = visual_pinNumber - PORTE_FIRST_PIN;
-		break;
+	/* Check if input pointer is not Null pointer */
+	if(NULL_PTR == Counters)
+	{
+		/* Report to DET  */
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_GET_SCRUB_COUNTERS_SID,
+				PORT_E_PARAM_POINTER
+		);
+	}
+	else
+#endif
+	{
+		*Counters = g_Port_scrubCounters;
 
-	case PORTF:
+		PORT_TRACE(PORT_GET_SCRUB_COUNTERS_SID, INITIAL_VALUE, g_Port_scrubCounters.Passes);
+	}
+}/*End of Port_GetScrubCounters Function*/
+#endif
 
-		/*
-		 * Calculate the actual pin number in portF by removing the  (8 (no of pins per port) * Port number)
-		 * which equals to PORTF first pin
-		 */
-		pin_number = visual_pinNumber - PORTF_FIRST_PIN;
-		break;
+#if (PORT_SET_PINS_CONFIG_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_SetPinsConfig
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  -Pins - Array of the {pin, mode, direction} entries
+ *                   -Count - Number of the entries
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - E_OK: all the entries are applied
+ *                                E_NOT_OK: an entry is invalid, or the pins are parked by
+ *                                          Port_EnterLowPower, and no pin is changed
+ * Description: Sets the mode and the direction of a group of pins (e.g. the pins of a peripheral
+ *              switched to DIO for a wake up). All the entries are validated first, then they are
+ *              folded into one image per port and GPIODIR, GPIOAMSEL, GPIODEN, GPIOAFSEL and
+ *              GPIOPCTL are written once per affected port, so the pins do not pass through the
+ *              intermediate states of one Port_SetPinMode call per pin. The pins which become
+ *              outputs lose their pull resistor and get the initial value of their configuration
+ *              before their direction (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+Std_ReturnType Port_SetPinsConfig( const Port_PinConfigType* Pins, uint8 Count )
+{
+	/*local variable to store the result of the service*/
+	Std_ReturnType result = E_NOT_OK;
 
-	default:
-		/*....No action Required....*/
-		break;
+	/*local variable to store the error of the first invalid entry, PORT_E_NO_ERROR if all of them are valid*/
+	uint8 errorId = PORT_E_NO_ERROR;
+
+	/*local variables to use them as counters for the entries and the ports*/
+	uint8 entry;
+	uint8 port;
+
+	/*local variable to store the pins of the current port which become outputs*/
+	uint8 outputs;
+
+	/*local pointer to the location of the pin of the current entry*/
+	const Port_PinLocationType * location;
+
+	/*local array of the new register values of the affected pins of every port*/
+	Port_PortImageType images[PORT_NUMBER_OF_PORTS];
+
+	/* point to the required Port Registers base address */
+	volatile uint32 * Port_Ptr;
+
+	/*the checks are not only development errors: an invalid entry rejects the whole list*/
+	if (PORT_NOT_INITIALIZED == g_Port_Status)
+	{
+		errorId = PORT_E_UNINIT;
+	}
+	else if ((NULL_PTR == Pins) && (Count != INITIAL_VALUE))
+	{
+		errorId = PORT_E_PARAM_POINTER;
+	}
+#if (PORT_LOW_POWER_API == STD_ON)
+	/* the pins are parked and their ports may be gated until Port_ExitLowPower */
+	else if (TRUE == g_Port_lowPower)
+	{
+		errorId = PORT_E_POWER_STATE;
+	}
+#endif
+	else
+	{
+		for(entry = INITIAL_VALUE; (PORT_E_NO_ERROR == errorId) && (entry < Count); entry++)
+		{
+			errorId = Port_checkPinConfig(&Pins[entry]);
+		}
 	}
 
-	return pin_number;
+	if(PORT_E_NO_ERROR == errorId)
+	{
+		/*fold the entries into the images of their ports, a later entry of the same pin wins*/
+		for(port = INITIAL_VALUE; port < PORT_NUMBER_OF_PORTS; port++)
+		{
+			images[port].Pins  = INITIAL_VALUE;
+			images[port].Dir   = INITIAL_VALUE;
+			images[port].Den   = INITIAL_VALUE;
+			images[port].Afsel = INITIAL_VALUE;
+			images[port].Amsel = INITIAL_VALUE;
+			images[port].Pctl  = INITIAL_VALUE;
+		}
 
-}
-/******************************************************************************************/
+		for(entry = INITIAL_VALUE; entry < Count; entry++)
+		{
+			location = PORT_PIN_LOCATION(Pins[entry].Pin);
+			images[location->Port].Pins |= (uint8)(1U << location->Bit);
+			if(PORT_PIN_OUT == Pins[entry].Direction)
+			{
+				images[location->Port].Dir |= (uint8)(1U << location->Bit);
+			}
+			else
+			{
+				images[location->Port].Dir &= (uint8)(~(1U << location->Bit));
+			}
+			Port_imageSetMode(&images[location->Port], location->Bit, Pins[entry].Mode);
+
+#if (PORT_SCRUB_API == STD_ON)
+			/* keep the expected image of the scrubber up to date with the new mode of the pin */
+			Port_imageSetMode(&g_Port_expectedImages[location->Port], location->Bit, Pins[entry].Mode);
+#endif
+		}
+
+		/*write every register once per affected port*/
+		for(port = INITIAL_VALUE; port < PORT_NUMBER_OF_PORTS; port++)
+		{
+			if(images[port].Pins != INITIAL_VALUE)
+			{
+				Port_Ptr = Port_BaseAddresses[port];
+
+				/* the pins which are inputs now and outputs in the new configuration */
+				outputs = images[port].Dir & (uint8)(~REG_READ32(REG_ADDRESS(Port_Ptr, PORT_DIR_REG_OFFSET)));
+				if(outputs != INITIAL_VALUE)
+				{
+					/* no pull resistor on a driven pin, and its initial value before its direction */
+					Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PULL_UP_REG_OFFSET), outputs,
+							Port_ImplementedPins[port], INITIAL_VALUE);
+					Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PULL_DOWN_REG_OFFSET), outputs,
+							Port_ImplementedPins[port], INITIAL_VALUE);
+					REG_WRITE32(REG_ADDRESS(Port_Ptr, (uint32)outputs << 2U), g_Port_images[port].Data);
+
+#if (PORT_SCRUB_API == STD_ON)
+					g_Port_expectedImages[port].Pur &= (uint8)(~outputs);
+					g_Port_expectedImages[port].Pdr &= (uint8)(~outputs);
+#endif
+				}
+				else
+				{
+					/* No Action Required */
+				}
+
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_DIR_REG_OFFSET), images[port].Pins,
+						Port_ImplementedPins[port], images[port].Dir);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET), images[port].Pins,
+						Port_ImplementedPins[port], images[port].Amsel);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET), images[port].Pins,
+						Port_ImplementedPins[port], images[port].Den);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_ALT_FUNC_REG_OFFSET), images[port].Pins,
+						Port_ImplementedPins[port], images[port].Afsel);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PCTL_REG_OFFSET), Port_pctlMask(images[port].Pins),
+						Port_pctlMask(Port_ImplementedPins[port]), images[port].Pctl);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		PORT_TRACE(PORT_SET_PINS_CONFIG_SID, Count, INITIAL_VALUE);
+		result = E_OK;
+	}
+	else
+	{
+		/* no pin is changed, the first invalid entry is reported to the Det if it is enabled */
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_SET_PINS_CONFIG_SID,
+				errorId
+		);
+#endif
+	}
+	return result;
+}/*End of Port_SetPinsConfig Function*/
+#endif
+
+#if (PORT_PROFILES_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_SwitchProfile
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  -Profile - Profile of the pins configuration to switch to
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Switches the pins configuration from the active profile to another one using the
+ *              delta of the two profiles generated at compile time: only the registers with
+ *              differing bits are written, and only these bits. The pins which become outputs get
+ *              their initial value before their direction. The direction and the mode of the pins
+ *              changed during runtime are kept unless the two profiles differ on them
+ *              (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+void Port_SwitchProfile( Port_ProfileType Profile )
+{
+	/*
+	 * local variable to store the status of Port_SwitchProfile
+	 * if it has Det error or not and prevent the function from work
+	 */
+	boolean switchError = FALSE;
+
+	/*local variable to use it as counter for the ports*/
+	uint8 port;
+
+	/*local pointers to the deltas of the switch and to the register images of the new profile*/
+	const volatile Port_PortImageType * delta;
+	const volatile Port_PortImageType * image;
+
+	/*local variable to store the pins of the current port which become outputs*/
+	uint8 outputs;
+
+	/*local variable to store the implemented pins of the current port*/
+	uint32 fullMask;
+
+	/* point to the required Port Registers base address */
+	volatile uint32 * Port_Ptr;
+
+#if (PORT_SCRUB_API == STD_ON)
+	/*local pointer to the expected image of the scrubber of the current port*/
+	Port_PortImageType * expected;
+#endif
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+
+	/* Check if the Driver is initialized before using this function */
+	if (PORT_NOT_INITIALIZED == g_Port_Status)
+	{
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_SWITCH_PROFILE_SID,
+				PORT_E_UNINIT
+		);
+		switchError = TRUE;
+	}
+	/* Check if the profile is one of the configured profiles */
+	else if (Profile >= PORT_NUMBER_OF_PROFILES)
+	{
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_SWITCH_PROFILE_SID,
+				PORT_E_PARAM_PROFILE
+		);
+		switchError = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+#endif
+
+#if (PORT_LOW_POWER_API == STD_ON)
+	/* the pins are parked and their ports may be gated until Port_ExitLowPower */
+	if ((FALSE == switchError) && (TRUE == g_Port_lowPower))
+	{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_SWITCH_PROFILE_SID,
+				PORT_E_POWER_STATE
+		);
+#endif
+		switchError = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/*Check the status of the error to make sure there is no Det error occurs*/
+	if(FALSE == switchError)
+	{
+		delta = g_Port_helperPtr->Deltas[g_Port_profile][Profile].Images;
+		image = g_Port_helperPtr->Profiles[Profile].Images;
+
+		for(port = INITIAL_VALUE; port < PORT_NUMBER_OF_PORTS; port++)
+		{
+			/* the ports with no overridden pin in the two profiles are not accessed */
+			if(delta[port].Pins != INITIAL_VALUE)
+			{
+				Port_Ptr = Port_BaseAddresses[port];
+				fullMask = Port_ImplementedPins[port];
+				outputs = delta[port].Dir & image[port].Dir;
+
+				/* Unlock the GPIOCR register and commit the locked pins */
+				if(delta[port].Commit != INITIAL_VALUE)
+				{
+					REG_WRITE32(REG_ADDRESS(Port_Ptr, PORT_LOCK_REG_OFFSET), UNLOCK_VALUE);
+					REG_UPDATE_FIELD32(REG_ADDRESS(Port_Ptr, PORT_COMMIT_REG_OFFSET), delta[port].Commit, delta[port].Commit);
+				}
+				else
+				{
+					/* No Action Required */
+				}
+
+				/* Initial values of the new outputs, the address mask selects only these pins */
+				if(outputs != INITIAL_VALUE)
+				{
+					REG_WRITE32(REG_ADDRESS(Port_Ptr, (uint32)outputs << 2U), image[port].Data);
+				}
+				else
+				{
+					/* No Action Required */
+				}
+
+				/* Port_writeMasked does not access the registers with no differing bits */
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_DIR_REG_OFFSET), delta[port].Dir, fullMask, image[port].Dir);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PULL_UP_REG_OFFSET), delta[port].Pur, fullMask, image[port].Pur);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PULL_DOWN_REG_OFFSET), delta[port].Pdr, fullMask, image[port].Pdr);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET), delta[port].Amsel, fullMask, image[port].Amsel);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET), delta[port].Den, fullMask, image[port].Den);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_ALT_FUNC_REG_OFFSET), delta[port].Afsel, fullMask, image[port].Afsel);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PCTL_REG_OFFSET), delta[port].Pctl,
+						Port_pctlMask((uint8)fullMask), image[port].Pctl);
+
+#if (PORT_SCRUB_API == STD_ON)
+				/* the expected image of the scrubber takes the switched bits of the new profile */
+				expected = &g_Port_expectedImages[port];
+				expected->Pur   = (expected->Pur & (uint8)(~delta[port].Pur)) | (image[port].Pur & delta[port].Pur);
+				expected->Pdr   = (expected->Pdr & (uint8)(~delta[port].Pdr)) | (image[port].Pdr & delta[port].Pdr);
+				expected->Den   = (expected->Den & (uint8)(~delta[port].Den)) | (image[port].Den & delta[port].Den);
+				expected->Afsel = (expected->Afsel & (uint8)(~delta[port].Afsel)) | (image[port].Afsel & delta[port].Afsel);
+				expected->Amsel = (expected->Amsel & (uint8)(~delta[port].Amsel)) | (image[port].Amsel & delta[port].Amsel);
+				expected->Pctl  = (expected->Pctl & ~delta[port].Pctl) | (image[port].Pctl & delta[port].Pctl);
+#endif
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		PORT_TRACE(PORT_SWITCH_PROFILE_SID, Profile, g_Port_profile);
+
+		/* the changeable pins and the refreshed directions follow the new profile */
+		g_Port_images = image;
+		g_Port_profile = Profile;
+	}
+	else
+	{
+		/*No Action Needed*/
+	}
+}/*End of Port_SwitchProfile Function*/
+#endif
+
+#if (PORT_LOW_POWER_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_EnterLowPower
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Parks every configured pin which is not active in the low power mode as a digital
+ *              disabled input (no alternative function, no analog, PORT_LOW_POWER_PARK_RESISTOR)
+ *              after saving its registers, then gates the clocks of the ports with no active pin
+ *              with one write. PORTC is never gated as it holds the JTAG pins. The services which
+ *              write the pins configuration are rejected until Port_ExitLowPower
+ *              (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+void Port_EnterLowPower( void )
+{
+	/*
+	 * local variable to store the status of Port_EnterLowPower
+	 * if it has Det error or not and prevent the function from work
+	 */
+	boolean lowPowerError = FALSE;
+
+	/*local variable to use it as counter for the ports*/
+	uint8 port;
+
+	/*local variable to store the parked pins of the current port*/
+	uint8 parked;
+
+	/*local variable to store the clock gating bits of the ports with no active pin*/
+	uint32 gated = INITIAL_VALUE;
+
+	/*local pointer to the saved registers of the current port*/
+	Port_PortImageType * saved;
+
+	/* point to the required Port Registers base address */
+	volatile uint32 * Port_Ptr;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+
+	/* Check if the Driver is initialized before using this function */
+	if (PORT_NOT_INITIALIZED == g_Port_Status)
+	{
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_ENTER_LOW_POWER_SID,
+				PORT_E_UNINIT
+		);
+		lowPowerError = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+#endif
+
+	/* Check if the pins are not already parked, the saved registers and the clocks gating depend on it */
+	if ((FALSE == lowPowerError) && (TRUE == g_Port_lowPower))
+	{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_ENTER_LOW_POWER_SID,
+				PORT_E_POWER_STATE
+		);
+#endif
+		lowPowerError = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	/*Check the status of the error to make sure there is no Det error occurs*/
+	if(FALSE == lowPowerError)
+	{
+		for(port = INITIAL_VALUE; port < PORT_NUMBER_OF_PORTS; port++)
+		{
+			parked = g_Port_images[port].Pins & (uint8)(~(g_Port_helperPtr->LowPowerActive[port]));
+			saved = &g_Port_savedImages[port];
+			saved->Pins = parked;
+
+			if(parked != INITIAL_VALUE)
+			{
+				Port_Ptr = Port_BaseAddresses[port];
+
+				/* the address mask of GPIODATA selects only the parked pins */
+				saved->Data = (uint8)REG_READ32(REG_ADDRESS(Port_Ptr, (uint32)parked << 2U));
+
+				/* stop driving the outputs first, then select the pull and disable the digital and analog functions */
+				saved->Dir   = Port_parkRegister(REG_ADDRESS(Port_Ptr, PORT_DIR_REG_OFFSET), parked, INITIAL_VALUE);
+				saved->Pur   = Port_parkRegister(REG_ADDRESS(Port_Ptr, PORT_PULL_UP_REG_OFFSET), parked, PORT_PARK_PUR_VALUE);
+				saved->Pdr   = Port_parkRegister(REG_ADDRESS(Port_Ptr, PORT_PULL_DOWN_REG_OFFSET), parked, PORT_PARK_PDR_VALUE);
+				saved->Den   = Port_parkRegister(REG_ADDRESS(Port_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET), parked, INITIAL_VALUE);
+				saved->Amsel = Port_parkRegister(REG_ADDRESS(Port_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET), parked, INITIAL_VALUE);
+				saved->Afsel = Port_parkRegister(REG_ADDRESS(Port_Ptr, PORT_ALT_FUNC_REG_OFFSET), parked, INITIAL_VALUE);
+
+				/* the PMCx fields of the parked pins are cleared with the alternative functions */
+				saved->Pctl = REG_READ32(REG_ADDRESS(Port_Ptr, PORT_PCTL_REG_OFFSET)) & Port_pctlMask(parked);
+				if(saved->Pctl != INITIAL_VALUE)
+				{
+					REG_UPDATE_FIELD32(REG_ADDRESS(Port_Ptr, PORT_PCTL_REG_OFFSET), saved->Pctl, INITIAL_VALUE);
+				}
+				else
+				{
+					/* No Action Required */
+				}
+			}
+			else
+			{
+				/* No Action Required */
+			}
+
+			if((INITIAL_VALUE == g_Port_helperPtr->LowPowerActive[port]) && (PORTC != port))
+			{
+				gated |= ((uint32)1U << port);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		/* Gate the clocks of all the ports with no active pin at once, after their last access */
+		if(gated != INITIAL_VALUE)
+		{
+			REG_UPDATE_FIELD32(&SYSCTL_REGCGC2_REG, gated, INITIAL_VALUE);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		g_Port_gatedPorts = gated;
+		g_Port_lowPower = TRUE;
+
+		PORT_TRACE(PORT_ENTER_LOW_POWER_SID, INITIAL_VALUE, gated);
+	}
+	else
+	{
+		/*No Action Needed*/
+	}
+}/*End of Port_EnterLowPower Function*/
+
+/************************************************************************************
+ * Service Name: Port_ExitLowPower
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Enables the clocks gated by Port_EnterLowPower with one write, then restores the
+ *              parked pins of every port from their saved registers with one write per register
+ *              (no read when all the implemented pins of the port are parked). The outputs get
+ *              their saved level before their direction (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+void Port_ExitLowPower( void )
+{
+	/*
+	 * local variable to store the status of Port_ExitLowPower
+	 * if it has Det error or not and prevent the function from work
+	 */
+	boolean lowPowerError = FALSE;
+
+	/*local variable to use it as counter for the ports*/
+	uint8 port;
+
+	/*local variable to store the parked outputs of the current port*/
+	uint8 outputs;
+
+	/*local variable to store the implemented pins of the current port*/
+	uint32 fullMask;
+
+	/*local pointer to the saved registers of the current port*/
+	const Port_PortImageType * saved;
+
+	/* point to the required Port Registers base address */
+	volatile uint32 * Port_Ptr;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+
+	/* Check if the Driver is initialized before using this function */
+	if (PORT_NOT_INITIALIZED == g_Port_Status)
+	{
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_EXIT_LOW_POWER_SID,
+				PORT_E_UNINIT
+		);
+		lowPowerError = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+#endif
+
+	/* Check if the pins are parked, the saved registers and the clocks gating depend on it */
+	if ((FALSE == lowPowerError) && (FALSE == g_Port_lowPower))
+	{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_EXIT_LOW_POWER_SID,
+				PORT_E_POWER_STATE
+		);
+#endif
+		lowPowerError = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	/*Check the status of the error to make sure there is no Det error occurs*/
+	if(FALSE == lowPowerError)
+	{
+		/* Enable the clocks of all the gated ports at once */
+		if(g_Port_gatedPorts != INITIAL_VALUE)
+		{
+			REG_UPDATE_FIELD32(&SYSCTL_REGCGC2_REG, g_Port_gatedPorts, g_Port_gatedPorts);
+
+			/* Allow time for the clocks to start */
+			(void)REG_READ32(&SYSCTL_REGCGC2_REG);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		for(port = INITIAL_VALUE; port < PORT_NUMBER_OF_PORTS; port++)
+		{
+			saved = &g_Port_savedImages[port];
+			if(saved->Pins != INITIAL_VALUE)
+			{
+				Port_Ptr = Port_BaseAddresses[port];
+				fullMask = Port_ImplementedPins[port];
+				outputs = saved->Pins & saved->Dir;
+
+				/* Saved levels of the outputs, the address mask selects only the parked outputs */
+				if(outputs != INITIAL_VALUE)
+				{
+					REG_WRITE32(REG_ADDRESS(Port_Ptr, (uint32)outputs << 2U), saved->Data);
+				}
+				else
+				{
+					/* No Action Required */
+				}
+
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_DIR_REG_OFFSET), saved->Pins, fullMask, saved->Dir);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PULL_UP_REG_OFFSET), saved->Pins, fullMask, saved->Pur);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PULL_DOWN_REG_OFFSET), saved->Pins, fullMask, saved->Pdr);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET), saved->Pins, fullMask, saved->Amsel);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET), saved->Pins, fullMask, saved->Den);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_ALT_FUNC_REG_OFFSET), saved->Pins, fullMask, saved->Afsel);
+				Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PCTL_REG_OFFSET), Port_pctlMask(saved->Pins),
+						Port_pctlMask((uint8)fullMask), saved->Pctl);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		g_Port_lowPower = FALSE;
+
+		PORT_TRACE(PORT_EXIT_LOW_POWER_SID, INITIAL_VALUE, g_Port_gatedPorts);
+	}
+	else
+	{
+		/*No Action Needed*/
+	}
+}/*End of Port_ExitLowPower Function*/
+#endif
+
+
+/************************************************************************************************
+ * Function Name: Port_refreshPort
+ * Parameters (in):  -Port - Index of the port (PORTA ... PORTF)
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Non AUTOSAR function to refresh the direction of the pins of one port which are
+ *              configured as direction unchangeable during runtime, using the register image of
+ *              the port: one read of GPIODIR and one write only if the direction of any of these
+ *              pins is corrupted. The direction changeable pins and the JTAG pins keep their value.
+ ************************************************************************************************/
+STATIC void Port_refreshPort(uint8 Port)
+{
+	/*local pointer to the register image of the port*/
+	const volatile Port_PortImageType * image = &(g_Port_images[Port]);
+
+	/*local variable to store the pins of the port which their direction is refreshed*/
+	uint32 refreshMask = (uint32)(image->Pins) & (uint32)(~(uint32)(image->DirChangeable));
+
+	/*local variables to store the current and the expected value of the GPIODIR register*/
+	uint32 currentDir;
+	uint32 expectedDir;
+
+	if(refreshMask != INITIAL_VALUE)
+	{
+		currentDir = REG_READ32(REG_ADDRESS(Port_BaseAddresses[Port], PORT_DIR_REG_OFFSET));
+		expectedDir = (currentDir & ~refreshMask) | ((uint32)(image->Dir) & refreshMask);
+
+		/* write the GPIODIR register only if the direction of any refreshed pin is corrupted */
+		if(currentDir != expectedDir)
+		{
+			REG_WRITE32(REG_ADDRESS(Port_BaseAddresses[Port], PORT_DIR_REG_OFFSET), expectedDir);
+		}
+		else
+		{
+			/*.....No action Required.....*/
+		}
+	}
+	else
+	{
+		/*.....No action Required.....*/
+	}
+}
+/******************************************************************************************/
+
+#if (PORT_SCRUB_API == STD_ON)
+/************************************************************************************************
+ * Function Name: Port_scrubRegister
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): - Port : Index of the port (PORTA ... PORTF)
+ *                  - Register : Index of the register (PORT_SCRUB_DEN ... PORT_SCRUB_PCTL)
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - TRUE if the register is checked, FALSE if the port has no configured pins
+ * Description: Compare the bits of the configured pins in one register with the expected image of
+ *              the port, and restore them with one write only if any of them drifted.
+ *************************************************************************************************/
+STATIC boolean Port_scrubRegister(uint8 Port, uint8 Register)
+{
+	/*local pointer to the expected register image of the port*/
+	const Port_PortImageType * image = &g_Port_expectedImages[Port];
+
+	/*local pointer to the checked register*/
+	volatile uint32 * reg;
+
+	/*local variables to store the checked bits and their expected values*/
+	uint32 mask = image->Pins;
+	uint32 expected;
+
+	/*local variables to store the live and the restored value of the register*/
+	uint32 live;
+	uint32 restored;
+
+	boolean checked = FALSE;
+
+	if(image->Pins != INITIAL_VALUE)
+	{
+		switch(Register)
+		{
+		case PORT_SCRUB_DEN:
+			expected = image->Den;
+			break;
+		case PORT_SCRUB_AFSEL:
+			expected = image->Afsel;
+			break;
+		case PORT_SCRUB_AMSEL:
+			expected = image->Amsel;
+			break;
+		case PORT_SCRUB_PUR:
+			expected = image->Pur;
+			break;
+		case PORT_SCRUB_PDR:
+			expected = image->Pdr;
+			break;
+		default:
+			mask = Port_pctlMask(image->Pins);
+			expected = image->Pctl;
+			break;
+		}
+
+		reg = REG_ADDRESS(Port_BaseAddresses[Port], Port_ScrubOffsets[Register]);
+		live = REG_READ32(reg);
+		restored = (live & ~mask) | (expected & mask);
+
+		/* write the register only if any bit of the configured pins drifted */
+		if(live != restored)
+		{
+			REG_WRITE32(reg, restored);
+			g_Port_scrubCounters.Drifts[Port][Register]++;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+		checked = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return checked;
+}
+
+#endif
+
+#if (((PORT_SCRUB_API == STD_ON) && (PORT_SET_PIN_MODE_API == STD_ON)) || (PORT_SET_PINS_CONFIG_API == STD_ON))
+/************************************************************************************************
+ * Function Name: Port_imageSetMode
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): - Bit : Number of the pin in its port (0 ... 7)
+ *                  - Mode : The new mode of the pin
+ * Parameters (inout): - Image : Register image of the port of the pin
+ * Parameters (out): None
+ * Return value: None
+ * Description: Update the GPIOAMSEL, GPIODEN, GPIOAFSEL and GPIOPCTL values of a pin in a
+ *              register image with a new mode, the same as Port_SetPinMode programs the registers.
+ *************************************************************************************************/
+STATIC void Port_imageSetMode(Port_PortImageType * Image, uint8 Bit, Port_PinModeType Mode)
+{
+	/*local variable to store the mask of the pin in the 8-bit registers*/
+	uint8 pinMask = (uint8)(1U << Bit);
+
+	Image->Pctl &= ~(PORT_PCTL_PIN_MASK << (Bit * BITS_NUMBER));
+
+	switch(Mode)
+	{
+	case PORT_PIN_MODE_DIO:
+		Image->Amsel &= (uint8)(~pinMask);
+		Image->Den |= pinMask;
+		Image->Afsel &= (uint8)(~pinMask);
+		break;
+
+	case PORT_PIN_MODE_ADC:
+		Image->Amsel |= pinMask;
+		Image->Den &= (uint8)(~pinMask);
+		Image->Afsel |= pinMask;
+		break;
+
+	default:
+		Image->Amsel &= (uint8)(~pinMask);
+		Image->Den |= pinMask;
+		Image->Afsel |= pinMask;
+		Image->Pctl |= (uint32)Mode << (Bit * BITS_NUMBER);
+		break;
+	}
+}
+#endif
+
+#if (PORT_BATCHED_INIT == STD_ON)
+/************************************************************************************************
+ * Function Name: Port_writeImages
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): - Images : Array of the register images of all the ports
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Enable the clocks of all the configured ports at once, then write every GPIO
+ *              register once per port. The initial levels of the outputs are written through
+ *              the GPIODATA address mask before the pins are switched to outputs.
+ *************************************************************************************************/
+STATIC void Port_writeImages(const Port_PortImageType * Images)
+{
+	/*local variable to use it as counter for the ports*/
+	uint8 port;
+
+	/*local variable to store the clocks of the configured ports*/
+	uint32 clocks = INITIAL_VALUE;
+
+	/*local variables to store the inputs and the outputs of the current port*/
+	uint8 inputs;
+	uint8 outputs;
+
+	/*local variables to store the implemented pins of the current port*/
+	uint32 fullMask;
+
+	/* point to the required Port Registers base address */
+	volatile uint32 * Port_Ptr;
+
+	for(port = INITIAL_VALUE; port < PORT_NUMBER_OF_PORTS; port++)
+	{
+		if(Images[port].Pins != INITIAL_VALUE)
+		{
+			clocks |= ((uint32)1U << port);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+
+	/* Enable the clocks of all the configured ports */
+	REG_UPDATE_FIELD32(&SYSCTL_REGCGC2_REG, clocks, clocks);
+
+	/* Allow time for the clocks to start */
+	(void)REG_READ32(&SYSCTL_REGCGC2_REG);
+
+	for(port = INITIAL_VALUE; port < PORT_NUMBER_OF_PORTS; port++)
+	{
+		if(Images[port].Pins != INITIAL_VALUE)
+		{
+			Port_Ptr = Port_BaseAddresses[port];
+			fullMask = Port_ImplementedPins[port];
+			outputs = Images[port].Pins & Images[port].Dir;
+			inputs = Images[port].Pins & (uint8)(~Images[port].Dir);
+
+			/* Unlock the GPIOCR register and commit the locked pins */
+			if(Images[port].Commit != INITIAL_VALUE)
+			{
+				REG_WRITE32(REG_ADDRESS(Port_Ptr, PORT_LOCK_REG_OFFSET), UNLOCK_VALUE);
+				REG_UPDATE_FIELD32(REG_ADDRESS(Port_Ptr, PORT_COMMIT_REG_OFFSET), Images[port].Commit, Images[port].Commit);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+
+			/* Initial values of the outputs, the address mask selects only the output pins */
+			if(outputs != INITIAL_VALUE)
+			{
+				REG_WRITE32(REG_ADDRESS(Port_Ptr, (uint32)outputs << 2U), Images[port].Data);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+
+			Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_DIR_REG_OFFSET), Images[port].Pins, fullMask, Images[port].Dir);
+			Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PULL_UP_REG_OFFSET), inputs, fullMask, Images[port].Pur);
+			Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PULL_DOWN_REG_OFFSET), inputs, fullMask, Images[port].Pdr);
+			Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET), Images[port].Pins, fullMask, Images[port].Amsel);
+			Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET), Images[port].Pins, fullMask, Images[port].Den);
+			Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_ALT_FUNC_REG_OFFSET), Images[port].Pins, fullMask, Images[port].Afsel);
+			Port_writeMasked(REG_ADDRESS(Port_Ptr, PORT_PCTL_REG_OFFSET), Port_pctlMask(Images[port].Pins),
+					Port_pctlMask((uint8)fullMask), Images[port].Pctl);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+}
+#endif
+
+#if ((PORT_BATCHED_INIT == STD_ON) || (PORT_SET_PINS_CONFIG_API == STD_ON) || (PORT_PROFILES_API == STD_ON) ||\
+		(PORT_LOW_POWER_API == STD_ON))
+/************************************************************************************************
+ * Function Name: Port_writeMasked
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): - Reg : Register to be written
+ *                  - Mask : Bits of the register to be written
+ *                  - FullMask : All the implemented bits of the register
+ *                  - Value : Value of the bits to be written
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Write the masked bits of a register with a single store if the mask covers the
+ *              whole register, or with one exclusive read-modify-write otherwise.
+ *************************************************************************************************/
+STATIC void Port_writeMasked(volatile uint32 * Reg, uint32 Mask, uint32 FullMask, uint32 Value)
+{
+	if(Mask == FullMask)
+	{
+		REG_WRITE32(Reg, Value);
+	}
+	else if(Mask != INITIAL_VALUE)
+	{
+		REG_UPDATE_FIELD32(Reg, Mask, Value);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+#endif
+
+#if ((PORT_BATCHED_INIT == STD_ON) || (PORT_SCRUB_API == STD_ON) || (PORT_SET_PINS_CONFIG_API == STD_ON) ||\
+		(PORT_PROFILES_API == STD_ON) || (PORT_LOW_POWER_API == STD_ON))
+/************************************************************************************************
+ * Function Name: Port_pctlMask
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): - Pins : Mask of pins
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Mask of the PMCx fields of the pins in GPIOPCTL
+ * Description: Expand a mask of pins into the mask of their fields in GPIOPCTL.
+ *************************************************************************************************/
+STATIC uint32 Port_pctlMask(uint8 Pins)
+{
+	uint32 mask = INITIAL_VALUE;
+	uint8 pin;
+
+	for(pin = INITIAL_VALUE; pin < 8U; pin++)
+	{
+		if((Pins & (1U << pin)) != INITIAL_VALUE)
+		{
+			mask |= PORT_PCTL_PIN_MASK << (pin * BITS_NUMBER);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	return mask;
+}
+#endif
+
+#if (PORT_SET_PINS_CONFIG_API == STD_ON)
+/************************************************************************************************
+ * Function Name: Port_checkPinConfig
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): - Entry : One {pin, mode, direction} entry of Port_SetPinsConfig
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint8 - PORT_E_NO_ERROR or the error code of the invalid entry
+ * Description: Validate one entry the same as Port_SetPinMode and Port_SetPinDirection do: the pin
+ *              shall exist and be mode changeable (the JTAG pins never are), the mode shall be
+ *              valid and the direction may only differ from the configured one for the direction
+ *              changeable pins.
+ *************************************************************************************************/
+STATIC uint8 Port_checkPinConfig(const Port_PinConfigType * Entry)
+{
+	/*local variable to store the error of the entry*/
+	uint8 errorId = PORT_E_NO_ERROR;
+
+	/*local pointer to the location of the pin in the MCU*/
+	const Port_PinLocationType * location;
+
+	/*local variable to store the mask of the pin in the 8-bit registers*/
+	uint8 pinMask;
+
+	if( (Entry->Pin < PORTA_FIRST_PIN) || (Entry->Pin > PORTF_END_PIN) )
+	{
+		errorId = PORT_E_PARAM_PIN;
+	}
+	else
+	{
+		location = PORT_PIN_LOCATION(Entry->Pin);
+		pinMask = (uint8)(1U << location->Bit);
+
+		if( ((g_Port_images[location->Port].ModeChangeable) & pinMask) == INITIAL_VALUE )
+		{
+			errorId = PORT_E_MODE_UNCHANGEABLE;
+		}
+		else if (!PORT_MODE_IS_VALID(Entry->Mode))
+		{
+			errorId = PORT_E_PARAM_INVALID_MODE;
+		}
+		else if( (((g_Port_images[location->Port].DirChangeable) & pinMask) == INITIAL_VALUE) &&
+				(((g_Port_images[location->Port].Dir & pinMask) != INITIAL_VALUE) != (PORT_PIN_OUT == Entry->Direction)) )
+		{
+			errorId = PORT_E_DIRECTION_UNCHANGEABLE;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	return errorId;
+}
+#endif
+
+#if (PORT_LOW_POWER_API == STD_ON)
+/************************************************************************************************
+ * Function Name: Port_parkRegister
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): - Reg : Address of the register
+ *                  - Pins : Mask of the parked pins
+ *                  - Value : Parked value of the pins
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint8 - Bits of the parked pins in the register before parking them
+ * Description: Read a register once, then write the parked value of some pins only if any of
+ *              them has another value. The read and the write are exclusive and repeated if
+ *              the write fails, so the other pins of the register are not affected.
+ *************************************************************************************************/
+STATIC uint8 Port_parkRegister(volatile uint32 * Reg, uint8 Pins, uint8 Value)
+{
+	/*local variables to store the live and the parked value of the register*/
+	uint32 live;
+	uint32 parkedValue;
+	uint32 status;
+
+	do
+	{
+		live = REG_READ_EXCLUSIVE32(Reg);
+		parkedValue = (live & ~(uint32)Pins) | ((uint32)Value & (uint32)Pins);
+
+		if(parkedValue != live)
+		{
+			status = REG_WRITE_EXCLUSIVE32(Reg, parkedValue);
+		}
+		else
+		{
+			status = INITIAL_VALUE;
+		}
+	} while(status != INITIAL_VALUE);
+
+	return (uint8)(live & (uint32)Pins);
+}
+#endif
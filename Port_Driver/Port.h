@@ -16,7 +16,7 @@
 #define PORT_VENDOR_ID    (1000U)
 
 /* Port Module Id */
-#define PORT_MODULE_ID    (120U)
+#define PORT_MODULE_ID    (124U)
 
 /* Port Instance Id */
 #define PORT_INSTANCE_ID  (0U)
@@ -65,6 +65,10 @@
 #define JTAG_PIN1                                      (1U)
 #define JTAG_PIN2                                      (2U)
 #define JTAG_PIN3                                      (3U)
+#define PORT_NUMBER_OF_PORTS                           (6U)
+#define PORT_NUMBER_OF_PINS                            (PORTF_END_PIN - PORTA_FIRST_PIN + 1U)
+#define PORT_JTAG_PINS_MASK                            (0x0FU)
+#define PORT_PCTL_PIN_MASK                             (0x0000000FUL)
 
 /*******************************************************************************/
 
@@ -116,9 +120,30 @@
 /* Service ID for Port SetPinMode */
 #define PORT_SET_PIN_MODE_SID                        (uint8)0x04
 
+/* Service ID for Port Scrub Registers (Not exist in AUTOSAR 4.0.3 Port SWS Document) */
+#define PORT_SCRUB_REGISTERS_SID                     (uint8)0x05
+
+/* Service ID for Port Get Scrub Counters (Not exist in AUTOSAR 4.0.3 Port SWS Document) */
+#define PORT_GET_SCRUB_COUNTERS_SID                  (uint8)0x06
+
+/* Service ID for Port Set Pins Config (Not exist in AUTOSAR 4.0.3 Port SWS Document) */
+#define PORT_SET_PINS_CONFIG_SID                     (uint8)0x07
+
+/* Service ID for PORT Switch Profile (Not exist in AUTOSAR 4.0.3 Port SWS Document) */
+#define PORT_SWITCH_PROFILE_SID                      (uint8)0x08
+
+/* Service ID for PORT Enter Low Power (Not exist in AUTOSAR 4.0.3 Port SWS Document) */
+#define PORT_ENTER_LOW_POWER_SID                     (uint8)0x09
+
+/* Service ID for PORT Exit Low Power (Not exist in AUTOSAR 4.0.3 Port SWS Document) */
+#define PORT_EXIT_LOW_POWER_SID                      (uint8)0x0A
+
 /*******************************************************************************
  *                            PORT Error Codes                                 *
  *******************************************************************************/
+/*No error (Not exist in AUTOSAR 4.0.3 Port SWS Document)*/
+#define PORT_E_NO_ERROR                      (uint8)0x00
+
 /*Invalid Port Pin ID requested*/   
 #define PORT_E_PARAM_PIN                     (uint8)0x0A   
 
@@ -144,6 +169,16 @@
  * beside reporting this development error.
  */
 #define PORT_E_PARAM_POINTER                 (uint8)0x10   
+
+/*API Port_SwitchProfile service called with an invalid profile (Not exist in AUTOSAR 4.0.3 Port SWS Document)*/
+#define PORT_E_PARAM_PROFILE                 (uint8)0x11
+
+/*
+ * API Port_EnterLowPower service called in the low power mode or Port_ExitLowPower service
+ * called out of it, or API Port_SetPinDirection, Port_SetPinMode, Port_SetPinsConfig or
+ * Port_SwitchProfile service called in the low power mode (Not exist in AUTOSAR 4.0.3 Port SWS Document)
+ */
+#define PORT_E_POWER_STATE                   (uint8)0x12
 /*******************************************************************************
  *                      Port Data Types  Definitions                           *
  *******************************************************************************/
@@ -228,12 +263,297 @@ typedef struct
 }Port_ConfigChannel;
 
 
+/* Description: Register image of one GPIO port, the values of the registers for all the
+ *  configured pins of the port (the JTAG pins PC0-PC3 are never part of an image):
+ *  1. Pins   : mask of the configured pins, the other pins keep their register values
+ *  2. Commit : pins which need GPIOCR commit before being configured (PD7, PF0)
+ *  3. Dir    : GPIODIR value (outputs)
+ *  4. Data   : initial GPIODATA value of the outputs
+ *  5. Pur    : GPIOPUR value (inputs with pull up)
+ *  6. Pdr    : GPIOPDR value (inputs with pull down)
+ *  7. Den    : GPIODEN value (digital pins)
+ *  8. Afsel  : GPIOAFSEL value (alternative function and analog pins)
+ *  9. Amsel  : GPIOAMSEL value (analog pins)
+ * 10. Pctl   : GPIOPCTL value (PMCx field of every pin)
+ * 11. DirChangeable  : pins configured as direction changeable during runtime
+ * 12. ModeChangeable : pins configured as mode changeable during runtime
+ */
+typedef struct
+{
+	uint8 Pins;
+	uint8 Commit;
+	uint8 Dir;
+	uint8 Data;
+	uint8 Pur;
+	uint8 Pdr;
+	uint8 Den;
+	uint8 Afsel;
+	uint8 Amsel;
+	uint32 Pctl;
+	uint8 DirChangeable;
+	uint8 ModeChangeable;
+}Port_PortImageType;
+
+#if (PORT_SCRUB_API == STD_ON)
+/* Index of the registers checked by the scrubber in the drift counters */
+#define PORT_SCRUB_DEN                                 (0U)
+#define PORT_SCRUB_AFSEL                               (1U)
+#define PORT_SCRUB_AMSEL                               (2U)
+#define PORT_SCRUB_PUR                                 (3U)
+#define PORT_SCRUB_PDR                                 (4U)
+#define PORT_SCRUB_PCTL                                (5U)
+#define PORT_SCRUB_REGISTERS                           (6U)
+
+/* Description: Counters of the register scrubber:
+ *  1. Passes : number of complete passes over all the registers of all the ports
+ *  2. Drifts : number of drifted and restored registers of every port
+ */
+typedef struct
+{
+	uint32 Passes;
+	uint32 Drifts[PORT_NUMBER_OF_PORTS][PORT_SCRUB_REGISTERS];
+}Port_ScrubCountersType;
+#endif
+
+#if (PORT_SET_PINS_CONFIG_API == STD_ON)
+/* Description: One entry of Port_SetPinsConfig:
+ *  1. Pin       : the pin ID
+ *  2. Mode      : the new mode of the pin
+ *  3. Direction : the new direction of the pin
+ */
+typedef struct
+{
+	Port_PinType Pin;
+	Port_PinModeType Mode;
+	Port_PinDirectionType Direction;
+}Port_PinConfigType;
+#endif
+
+#if (PORT_PROFILES_API == STD_ON)
+/*Description: Data type for the profile of the pins configuration, PORT_PROFILE_RUN ...*/
+typedef uint8       Port_ProfileType;
+
+/* Description: Register images of all the ports for one profile, or delta between two profiles:
+ *  in a delta every register field holds the bits which differ between the two profiles,
+ *  Pins holds the pins overridden by any of them and Commit the locked pins among these pins
+ *  (Data and the changeable fields are not used)
+ */
+typedef struct
+{
+	Port_PortImageType Images[PORT_NUMBER_OF_PORTS];
+}Port_ProfileImagesType;
+#endif
+
+/* Description: Location of a pin ID in the MCU:
+ *  1. the base address of the registers of its port
+ *  2. its port (PORTA ... PORTF)
+ *  3. its actual number in the port (0 ... 7)
+ */
+typedef struct
+{
+	volatile uint32 * Base;
+	uint8 Port;
+	uint8 Bit;
+}Port_PinLocationType;
+
 /* Data Structure required for initializing the Port Driver */
 typedef struct Port_ConfigType
 {
 	Port_ConfigChannel Channels[PORT_CONFIGURED_CHANNLES];
+	/* Register images of the ports generated at compile time from the Channels configuration */
+	Port_PortImageType Images[PORT_NUMBER_OF_PORTS];
+#if (PORT_PROFILES_API == STD_ON)
+	/* Register images of every profile generated at compile time from the Channels and the profile overrides */
+	Port_ProfileImagesType Profiles[PORT_NUMBER_OF_PROFILES];
+	/* Deltas[From][To]: register bits written by the switch from the profile From to the profile To */
+	Port_ProfileImagesType Deltas[PORT_NUMBER_OF_PROFILES][PORT_NUMBER_OF_PROFILES];
+#endif
+#if (PORT_LOW_POWER_API == STD_ON)
+	/* Pins of every port which stay active in the low power mode, the other pins are parked */
+	uint8 LowPowerActive[PORT_NUMBER_OF_PORTS];
+#endif
 } Port_ConfigType;   
 
+/*******************************************************************************
+ *               Compile-time generation of the ports register images          *
+ *******************************************************************************/
+/*
+ * The pins configuration is written once as a list macro LIST(X, ARG) which calls
+ * X(ARG, pin ID, mode, direction, initial value, direction changeable, mode changeable, internal resistor)
+ * for every pin. PORT_IMAGE(LIST, PORT) expands the list into the register image of
+ * one port, every field is an OR of constant expressions evaluated by the compiler.
+ */
+
+/* Port (PORTA ... PORTF) of a pin ID */
+#define PORT_PIN_PORT(PIN)        (((PIN) < PORTB_FIRST_PIN) ? PORTA : ((PIN) < PORTC_FIRST_PIN) ? PORTB :\
+                                   ((PIN) < PORTD_FIRST_PIN) ? PORTC : ((PIN) < PORTE_FIRST_PIN) ? PORTD :\
+                                   ((PIN) < PORTF_FIRST_PIN) ? PORTE : PORTF)
+
+/* Number of a pin ID in its port (0 ... 7) */
+#define PORT_PIN_BIT(PIN)         ((PIN) - (((PIN) < PORTB_FIRST_PIN) ? PORTA_FIRST_PIN : ((PIN) < PORTC_FIRST_PIN) ? PORTB_FIRST_PIN :\
+                                            ((PIN) < PORTD_FIRST_PIN) ? PORTC_FIRST_PIN : ((PIN) < PORTE_FIRST_PIN) ? PORTD_FIRST_PIN :\
+                                            ((PIN) < PORTF_FIRST_PIN) ? PORTE_FIRST_PIN : PORTF_FIRST_PIN))
+
+/* Mask of a pin ID in its port */
+#define PORT_PIN_MASK(PIN)        (1U << PORT_PIN_BIT(PIN))
+
+/* JTAG pins (PC0 - PC3) which are never configured */
+#define PORT_PIN_IS_JTAG(PIN)     (((PIN) >= PORTC_FIRST_PIN) && ((PIN) <= (PORTC_FIRST_PIN + JTAG_PIN3)))
+
+/* Pins locked after reset which need GPIOCR commit (PD7, PF0) */
+#define PORT_PIN_IS_LOCKED(PIN)   (((PIN) == PORTD_END_PIN) || ((PIN) == PORTF_FIRST_PIN))
+
+/* Valid mode numbers: the PMCx values of the data sheet (0 ... 9 and 14) and ADC */
+#define PORT_MODE_IS_VALID(MODE)  (((MODE) <= MAXIMUM_MODE_NUMBER) || ((MODE) == LAST_MODE_NUMBER) || ((MODE) == PORT_PIN_MODE_ADC))
+
+/* Mask of a pin in the image of PORT, 0 if the pin is not part of this port image */
+#define PORT_IMAGE_PIN(PORT, PIN) (((PORT_PIN_PORT(PIN) == (PORT)) && !PORT_PIN_IS_JTAG(PIN)) ? PORT_PIN_MASK(PIN) : 0U)
+
+/* Contribution of one pin to every field of the image of PORT */
+#define PORT_IMAGE_PINS_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| PORT_IMAGE_PIN(PORT, PIN)
+#define PORT_IMAGE_COMMIT_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| (PORT_PIN_IS_LOCKED(PIN) ? PORT_IMAGE_PIN(PORT, PIN) : 0U)
+#define PORT_IMAGE_DIR_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| (((DIR) == PORT_PIN_OUT) ? PORT_IMAGE_PIN(PORT, PIN) : 0U)
+#define PORT_IMAGE_DATA_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| ((((DIR) == PORT_PIN_OUT) && ((INIT) == STD_HIGH)) ? PORT_IMAGE_PIN(PORT, PIN) : 0U)
+#define PORT_IMAGE_PUR_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| ((((DIR) == PORT_PIN_IN) && ((RES) == PULL_UP)) ? PORT_IMAGE_PIN(PORT, PIN) : 0U)
+#define PORT_IMAGE_PDR_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| ((((DIR) == PORT_PIN_IN) && ((RES) == PULL_DOWN)) ? PORT_IMAGE_PIN(PORT, PIN) : 0U)
+#define PORT_IMAGE_DEN_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| ((((MODE) != PORT_PIN_MODE_ADC) && PORT_MODE_IS_VALID(MODE)) ? PORT_IMAGE_PIN(PORT, PIN) : 0U)
+#define PORT_IMAGE_AFSEL_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| ((((MODE) != PORT_PIN_MODE_DIO) && PORT_MODE_IS_VALID(MODE)) ? PORT_IMAGE_PIN(PORT, PIN) : 0U)
+#define PORT_IMAGE_AMSEL_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| (((MODE) == PORT_PIN_MODE_ADC) ? PORT_IMAGE_PIN(PORT, PIN) : 0U)
+#define PORT_IMAGE_DIR_CH_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| (((DIR_CH) == directionChangable_ON) ? PORT_IMAGE_PIN(PORT, PIN) : 0U)
+#define PORT_IMAGE_MODE_CH_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| (((MODE_CH) == modeChangable_ON) ? PORT_IMAGE_PIN(PORT, PIN) : 0U)
+#define PORT_IMAGE_PCTL_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| (((PORT_IMAGE_PIN(PORT, PIN) != 0U) && ((MODE) != PORT_PIN_MODE_ADC) && PORT_MODE_IS_VALID(MODE)) ?\
+			((uint32)(MODE) << (PORT_PIN_BIT(PIN) * BITS_NUMBER)) : 0U)
+
+/* Register image of PORT generated from the pins list LIST */
+#define PORT_IMAGE(LIST, PORT) \
+	{ \
+		(uint8)(0U LIST(PORT_IMAGE_PINS_OF, PORT)), \
+		(uint8)(0U LIST(PORT_IMAGE_COMMIT_OF, PORT)), \
+		(uint8)(0U LIST(PORT_IMAGE_DIR_OF, PORT)), \
+		(uint8)(0U LIST(PORT_IMAGE_DATA_OF, PORT)), \
+		(uint8)(0U LIST(PORT_IMAGE_PUR_OF, PORT)), \
+		(uint8)(0U LIST(PORT_IMAGE_PDR_OF, PORT)), \
+		(uint8)(0U LIST(PORT_IMAGE_DEN_OF, PORT)), \
+		(uint8)(0U LIST(PORT_IMAGE_AFSEL_OF, PORT)), \
+		(uint8)(0U LIST(PORT_IMAGE_AMSEL_OF, PORT)), \
+		(uint32)(0U LIST(PORT_IMAGE_PCTL_OF, PORT)), \
+		(uint8)(0U LIST(PORT_IMAGE_DIR_CH_OF, PORT)), \
+		(uint8)(0U LIST(PORT_IMAGE_MODE_CH_OF, PORT)) \
+	}
+
+/*******************************************************************************
+ *               Compile-time validation of the pins lists                     *
+ *******************************************************************************/
+/*
+ * PORT_CHECK_PINS_LIST(LIST, NAME) fails the build if an entry of the pins list LIST has a pin ID
+ * out of PORTA_FIRST_PIN ... PORTF_END_PIN, a pin listed twice, a JTAG pin (PC0-PC3) configured as
+ * changeable, an invalid mode number or an internal resistor on an output.
+ * Every check is one constant expression over all the entries of the list.
+ */
+#define PORT_CHECK_RANGE_OF(ARG, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	&& ((PIN) >= PORTA_FIRST_PIN) && ((PIN) <= PORTF_END_PIN)
+#define PORT_CHECK_JTAG_OF(ARG, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	&& (!PORT_PIN_IS_JTAG(PIN) || (((DIR_CH) == directionChangable_OFF) && ((MODE_CH) == modeChangable_OFF)))
+#define PORT_CHECK_MODE_OF(ARG, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	&& PORT_MODE_IS_VALID(MODE)
+#define PORT_CHECK_PULL_OF(ARG, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	&& (((DIR) == PORT_PIN_IN) || ((RES) == OFF))
+#define PORT_CHECK_COUNT_OF(ARG, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	+ 1U
+
+/* Bit of a pin ID in a 64 bits mask: the sum of the bits of the list equals their OR only without duplicates */
+#define PORT_CHECK_PIN_BIT(PIN)   (((PIN) <= PORTF_END_PIN) ? ((uint64)1U << (PIN)) : 0U)
+#define PORT_CHECK_SUM_OF(ARG, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	+ PORT_CHECK_PIN_BIT(PIN)
+#define PORT_CHECK_OR_OF(ARG, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| PORT_CHECK_PIN_BIT(PIN)
+
+#define PORT_CHECK_PINS_LIST(LIST, NAME) \
+	STATIC_ASSERT(1 LIST(PORT_CHECK_RANGE_OF, 0U), NAME##_pin_out_of_range); \
+	STATIC_ASSERT((0U LIST(PORT_CHECK_SUM_OF, 0U)) == (0U LIST(PORT_CHECK_OR_OF, 0U)), NAME##_duplicate_pin); \
+	STATIC_ASSERT(1 LIST(PORT_CHECK_JTAG_OF, 0U), NAME##_changeable_jtag_pin); \
+	STATIC_ASSERT(1 LIST(PORT_CHECK_MODE_OF, 0U), NAME##_invalid_mode); \
+	STATIC_ASSERT(1 LIST(PORT_CHECK_PULL_OF, 0U), NAME##_resistor_on_output)
+
+/*
+ * The pins which stay active in the low power mode are a list macro LIST(X, ARG) which calls
+ * X(ARG, pin ID) for every pin, PORT_ACTIVE_PINS(LIST, PORT) is the mask of these pins in PORT
+ */
+#define PORT_ACTIVE_PIN_OF(PORT, PIN)  | PORT_IMAGE_PIN(PORT, PIN)
+#define PORT_ACTIVE_PINS(LIST, PORT)   (uint8)(0U LIST(PORT_ACTIVE_PIN_OF, PORT))
+
+/*******************************************************************************
+ *               Compile-time generation of the profiles                       *
+ *******************************************************************************/
+/*
+ * A profile is a list macro OVERRIDES(X, ARG) with the same entries as the pins list BASE for
+ * the pins whose configuration differs from BASE. The overridden pins take every field of their
+ * image from OVERRIDES and the other pins from BASE.
+ */
+
+/* Bits of the GPIOPCTL fields of the pins of PORT in a pins list (PMCx fields instead of pin bits) */
+#define PORT_IMAGE_PCTL_PINS_OF(PORT, PIN, MODE, DIR, INIT, DIR_CH, MODE_CH, RES) \
+	| ((PORT_IMAGE_PIN(PORT, PIN) != 0U) ? ((uint32)0xFU << (PORT_PIN_BIT(PIN) * BITS_NUMBER)) : 0U)
+
+/* Field of the image of PORT for the profile OVERRIDES, MASK_OF gives the bits of the overridden pins */
+#define PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, FIELD_OF, MASK_OF) \
+	(((0U BASE(FIELD_OF, PORT)) & ~(0U OVERRIDES(MASK_OF, PORT))) | (0U OVERRIDES(FIELD_OF, PORT)))
+
+/*
+ * Bits of a field which differ between the profiles FROM and TO: the pins overridden by both take
+ * the bits of the two overrides, the pins overridden by one of them only take the bits of BASE on
+ * the other side, and the pins overridden by none of them never differ
+ */
+#define PORT_PROFILE_FIELD_DELTA(BASE, FROM, TO, PORT, FIELD_OF, MASK_OF) \
+	((0U FROM(FIELD_OF, PORT)) ^ (0U TO(FIELD_OF, PORT)) ^ \
+	 ((0U BASE(FIELD_OF, PORT)) & ((0U FROM(MASK_OF, PORT)) ^ (0U TO(MASK_OF, PORT)))))
+
+/* Register image of PORT for the profile OVERRIDES of the pins list BASE */
+#define PORT_PROFILE_IMAGE(BASE, OVERRIDES, PORT) \
+	{ \
+		(uint8)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_PINS_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_COMMIT_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_DIR_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_DATA_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_PUR_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_PDR_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_DEN_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_AFSEL_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_AMSEL_OF, PORT_IMAGE_PINS_OF), \
+		(uint32)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_PCTL_OF, PORT_IMAGE_PCTL_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_DIR_CH_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD(BASE, OVERRIDES, PORT, PORT_IMAGE_MODE_CH_OF, PORT_IMAGE_PINS_OF) \
+	}
+
+/* Delta of PORT for the switch from the profile FROM to the profile TO of the pins list BASE */
+#define PORT_PROFILE_DELTA(BASE, FROM, TO, PORT) \
+	{ \
+		(uint8)((0U FROM(PORT_IMAGE_PINS_OF, PORT)) | (0U TO(PORT_IMAGE_PINS_OF, PORT))), \
+		(uint8)((0U FROM(PORT_IMAGE_COMMIT_OF, PORT)) | (0U TO(PORT_IMAGE_COMMIT_OF, PORT))), \
+		(uint8)PORT_PROFILE_FIELD_DELTA(BASE, FROM, TO, PORT, PORT_IMAGE_DIR_OF, PORT_IMAGE_PINS_OF), \
+		0U, \
+		(uint8)PORT_PROFILE_FIELD_DELTA(BASE, FROM, TO, PORT, PORT_IMAGE_PUR_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD_DELTA(BASE, FROM, TO, PORT, PORT_IMAGE_PDR_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD_DELTA(BASE, FROM, TO, PORT, PORT_IMAGE_DEN_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD_DELTA(BASE, FROM, TO, PORT, PORT_IMAGE_AFSEL_OF, PORT_IMAGE_PINS_OF), \
+		(uint8)PORT_PROFILE_FIELD_DELTA(BASE, FROM, TO, PORT, PORT_IMAGE_AMSEL_OF, PORT_IMAGE_PINS_OF), \
+		(uint32)PORT_PROFILE_FIELD_DELTA(BASE, FROM, TO, PORT, PORT_IMAGE_PCTL_OF, PORT_IMAGE_PCTL_PINS_OF), \
+		0U, \
+		0U \
+	}
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -260,7 +580,9 @@ void Port_Init( const Port_ConfigType* ConfigPtr );
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Sets the port pin direction
+ * Description: Sets the port pin direction. With PORT_BITBAND_ACCESS the direction bit
+ *              is written with one store to its bit-band alias, so the call does not race
+ *              with the interrupts which update other pins of the same port.
  ************************************************************************************/
 void Port_SetPinDirection( Port_PinType Pin, 
 		Port_PinDirectionType Direction
@@ -304,12 +626,113 @@ void Port_GetVersionInfo( Std_VersionInfoType* versioninfo );
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Sets the port pin mode.
+ * Description: Sets the port pin mode. With PORT_BITBAND_ACCESS the GPIOAMSEL, GPIODEN
+ *              and GPIOAFSEL bits are written through their bit-band aliases, the 4-bit
+ *              field of the pin in GPIOPCTL is written with an exclusive (LDREX / STREX)
+ *              update, so the call does not mask the interrupts.
  ************************************************************************************/
 void Port_SetPinMode( Port_PinType Pin, 
 		Port_PinModeType Mode
 );
 #endif
+
+#if (PORT_SCRUB_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_ScrubRegisters
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Compares GPIODEN, GPIOAFSEL, GPIOAMSEL, GPIOPUR, GPIOPDR and GPIOPCTL of the
+ *              configured pins with the expected image of every port and restores only the
+ *              drifted registers (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+void Port_ScrubRegisters( void );
+
+/************************************************************************************
+ * Service Name: Port_GetScrubCounters
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  None
+ * Parameters (inout): None
+ * Parameters (out): Counters - Pointer to where to store the counters of the scrubber
+ * Return value: None
+ * Description: Returns the passes and the drift counters of the register scrubber
+ *              (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+void Port_GetScrubCounters( Port_ScrubCountersType* Counters );
+#endif
+
+#if (PORT_SET_PINS_CONFIG_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_SetPinsConfig
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  -Pins - Array of the {pin, mode, direction} entries
+ *                   -Count - Number of the entries
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - E_OK: all the entries are applied
+ *                                E_NOT_OK: an entry is invalid, or the pins are parked by
+ *                                          Port_EnterLowPower, and no pin is changed
+ * Description: Sets the mode and the direction of a group of pins with one access per
+ *              register of every affected port, the pins which become outputs lose their pull
+ *              resistor and get their initial value before their direction
+ *              (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+Std_ReturnType Port_SetPinsConfig( const Port_PinConfigType* Pins, uint8 Count );
+#endif
+
+#if (PORT_PROFILES_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_SwitchProfile
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  -Profile - Profile of the pins configuration to switch to
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Switches the pins configuration to another profile by writing only the register
+ *              bits which differ between the current and the new profile
+ *              (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+void Port_SwitchProfile( Port_ProfileType Profile );
+#endif
+
+#if (PORT_LOW_POWER_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_EnterLowPower
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Saves and parks the pins which are not active in the low power mode and gates the
+ *              clocks of the ports with no active pin. Until Port_ExitLowPower Port_SetPinDirection,
+ *              Port_SetPinMode, Port_SetPinsConfig and Port_SwitchProfile are rejected with
+ *              PORT_E_POWER_STATE, Port_RefreshPortDirection and Port_ScrubRegisters do nothing.
+ *              A call while the pins are parked changes nothing, with or without the development
+ *              error detection (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+void Port_EnterLowPower( void );
+
+/************************************************************************************
+ * Service Name: Port_ExitLowPower
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):  None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Enables the gated clocks at once and restores the parked pins from the registers
+ *              saved by Port_EnterLowPower. A call while the pins are not parked changes nothing,
+ *              with or without the development error detection (Not exist in AUTOSAR 4.0.3 Port SWS Document).
+ ************************************************************************************/
+void Port_ExitLowPower( void );
+#endif
 /*******************************************************************************
  *                       External Variables                                    *
  *******************************************************************************/
@@ -26,8 +26,10 @@
 #define PORT_CFG_AR_RELEASE_MINOR_VERSION      (0U)
 #define PORT_CFG_AR_RELEASE_PATCH_VERSION      (3U)
 
-/* Pre-compile option for Development Error Detect */
+/* Pre-compile option for Development Error Detect (may be overridden by the build, e.g. the tests) */
+#ifndef PORT_DEV_ERROR_DETECT
 #define PORT_DEV_ERROR_DETECT                  (STD_ON)
+#endif
 
 /* Pre-compile option for Version Info API */
 #define PORT_VERSION_INFO_API                  (STD_ON)
@@ -38,6 +40,110 @@
 /* Pre-compile option to enable / disable the use of Port_SetPinMode function */
 #define PORT_SET_PIN_MODE_API                   (STD_ON)
 
+/*
+ * Pre-compile option to enable / disable the use of Port_SetPinsConfig function: a list of
+ * {pin, mode, direction} entries is validated as a whole, then applied with one access per
+ * register of every affected port
+ */
+#define PORT_SET_PINS_CONFIG_API                (STD_ON)
+
+/*
+ * Pre-compile option to enable / disable the use of Port_SwitchProfile function: every profile of
+ * Port_PBcfg.c overrides some pins of the configuration and the register bits which differ between
+ * every two profiles are computed at compile time, so a switch only writes these bits
+ */
+#define PORT_PROFILES_API                       (STD_ON)
+
+/*
+ * Profiles of the pins configuration, in the order of the profiles in Port_PBcfg.c.
+ * PORT_PROFILE_RUN is the configuration applied by Port_Init (it overrides no pin)
+ */
+#define PORT_PROFILE_RUN                        (0U)
+#define PORT_PROFILE_DIAGNOSTIC                 (1U)
+#define PORT_PROFILE_LOW_POWER                  (2U)
+#define PORT_NUMBER_OF_PROFILES                 (3U)
+
+/*
+ * Pre-compile option to enable / disable the use of Port_EnterLowPower and Port_ExitLowPower
+ * functions: the pins which are not active in the low power mode (Port_PBcfg.c) are parked as
+ * digital disabled inputs with PORT_LOW_POWER_PARK_RESISTOR, the clocks of the ports with no active
+ * pin are gated, and the wake up restores the parked pins from the registers saved on entry
+ */
+#define PORT_LOW_POWER_API                      (STD_ON)
+
+/* Internal resistor of the parked pins (OFF, PULL_UP or PULL_DOWN) */
+#define PORT_LOW_POWER_PARK_RESISTOR            (PULL_DOWN)
+
+/*
+ * Pre-compile option for the bit-band access: the single-bit updates of GPIODIR, GPIODEN, GPIOAFSEL,
+ * GPIOAMSEL, GPIOPUR and GPIOPDR (Port_SetPinDirection, Port_SetPinMode, the per pin Port_Init) are one
+ * store to the bit-band alias of the bit instead of a read-modify-write, so they are safe against the
+ * interrupts which update other pins of the same port (may be overridden by the build)
+ */
+#ifndef PORT_BITBAND_ACCESS
+#define PORT_BITBAND_ACCESS                     (STD_ON)
+#endif
+
+/*
+ * Pre-compile option for the validated configuration: Port_PBcfg.c checks its pins lists at compile
+ * time (PORT_CHECK_PINS_LIST), so Port_Init does not check the mode numbers of the configuration again
+ */
+#define PORT_CONFIG_VALIDATED                   (STD_ON)
+
+/*
+ * Pre-compile option for the batched initialization: Port_Init folds the configuration into
+ * one register image per port, enables all the needed port clocks at once and writes
+ * every GPIO register once per port instead of read-modify-write accesses per pin
+ * (may be overridden by the build)
+ */
+#ifndef PORT_BATCHED_INIT
+#define PORT_BATCHED_INIT                       (STD_ON)
+#endif
+
+/*
+ * Pre-compile option for the round robin refresh: every call of Port_RefreshPortDirection
+ * refreshes the direction of the next port only instead of all the ports
+ */
+#define PORT_REFRESH_ROUND_ROBIN                (STD_OFF)
+
+/*
+ * Pre-compile option to enable / disable the register scrubber: Port_ScrubRegisters compares
+ * GPIODEN, GPIOAFSEL, GPIOAMSEL, GPIOPUR, GPIOPDR and GPIOPCTL with the expected image of
+ * every port and restores only the drifted registers
+ */
+#define PORT_SCRUB_API                          (STD_ON)
+
+/*
+ * Pre-compile option for the incremental scrubbing: every call of Port_ScrubRegisters checks
+ * the next PORT_SCRUB_SLICE_REGISTERS registers only instead of all the registers of all the ports
+ * (may be overridden by the build, e.g. the tests)
+ */
+#ifndef PORT_SCRUB_INCREMENTAL
+#define PORT_SCRUB_INCREMENTAL                  (STD_OFF)
+#endif
+
+/* Number of the registers checked by one call of Port_ScrubRegisters in the incremental mode */
+#define PORT_SCRUB_SLICE_REGISTERS              (6U)
+
+/*
+ * Pre-compile option to select the GPIO aperture of every port: bit n selects the AHB aperture
+ * (0x40058000 ...) for port n (PORTA = bit 0 ... PORTF = bit 5) instead of the legacy APB one,
+ * Port_Init programs GPIOHBCTL and all the register accesses use the selected aperture.
+ * It shall be the same as DIO_AHB_PORTS_MASK in Dio_Cfg.h (may be overridden by the build)
+ */
+#ifndef PORT_AHB_PORTS_MASK
+#define PORT_AHB_PORTS_MASK                     (0x00U)
+#endif
+
+/*
+ * Pre-compile option for the tracing of the service calls: every call which passes the Det checks
+ * is recorded by the Trace module (SID, pin, value and time stamp) in its RAM ring buffer.
+ * When it is OFF the trace points compile to nothing (may be overridden by the build)
+ */
+#ifndef PORT_TRACE_API
+#define PORT_TRACE_API                          (STD_OFF)
+#endif
+
 /* Number of the configured Port Channels */
 #define PORT_CONFIGURED_CHANNLES                 (43U)
 
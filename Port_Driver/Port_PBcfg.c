@@ -41,51 +41,172 @@
 #endif
 
 
+/*
+ * Configuration of all the pins of the MCU, one entry per pin:
+ * X(ARG, pin ID, mode, direction, initial value, direction changeable, mode changeable, internal resistor)
+ * The list is expanded into the configuration structure of every pin and into the register
+ * images of the ports, so the images are computed by the compiler from the same data.
+ */
+#define PORT_PBCFG_PINS(X, ARG) \
+	X(ARG, PORT_PIN_01, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_04, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_05, PORT_PIN_MODE_DIO, PORT_PIN_IN, INITIAL_VALUE, directionChangable_ON, modeChangable_ON, PULL_UP) \
+	X(ARG, PORT_PIN_06, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_07, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_08, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_09, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_10, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_13, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_14, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_15, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_16, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_17, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_18, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_19, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_20, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_21, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_22, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_23, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_24, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_28, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_OUT, INITIAL_VALUE, directionChangable_ON, modeChangable_ON, OFF) \
+	X(ARG, PORT_PIN_30, PORT_PIN_MODE_DIO, PORT_PIN_OUT, INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, OFF) \
+	X(ARG, PORT_PIN_31, PORT_PIN_MODE_DIO, PORT_PIN_OUT, INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, OFF) \
+	X(ARG, PORT_PIN_43, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_44, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_45, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_46, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_47, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_48, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_49, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_50, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_51, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_52, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_53, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_57, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_58, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_59, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_60, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_61, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_62, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_63, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR) \
+	X(ARG, PORT_PIN_64, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR)
+
+#if (PORT_PROFILES_API == STD_ON)
+/*
+ * Profiles of the pins configuration, one list of the overridden pins per profile in the same
+ * format as PORT_PBCFG_PINS (the other pins keep their configuration of PORT_PBCFG_PINS)
+ */
+
+/* Run: the configuration of PORT_PBCFG_PINS */
+#define PORT_PBCFG_PROFILE_RUN(X, ARG)
+
+/* Diagnostic: PE3 (AIN0) and PE2 (AIN1) measure the supply rails */
+#define PORT_PBCFG_PROFILE_DIAGNOSTIC(X, ARG) \
+	X(ARG, PORT_PIN_06, PORT_PIN_MODE_ADC, PORT_PIN_IN, INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, OFF) \
+	X(ARG, PORT_PIN_07, PORT_PIN_MODE_ADC, PORT_PIN_IN, INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, OFF)
+
+/* Low power: the LEDs PF1 - PF3 are inputs pulled down, PF4 (SW1) keeps its pull up to wake up */
+#define PORT_PBCFG_PROFILE_LOW_POWER(X, ARG) \
+	X(ARG, PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_IN, INITIAL_VALUE, directionChangable_ON, modeChangable_ON, PULL_DOWN) \
+	X(ARG, PORT_PIN_30, PORT_PIN_MODE_DIO, PORT_PIN_IN, INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PULL_DOWN) \
+	X(ARG, PORT_PIN_31, PORT_PIN_MODE_DIO, PORT_PIN_IN, INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PULL_DOWN)
+
+/* Register images of all the ports for one profile */
+#define PORT_PBCFG_PROFILE(OVERRIDES) \
+	{{ \
+		PORT_PROFILE_IMAGE(PORT_PBCFG_PINS, OVERRIDES, PORTA), \
+		PORT_PROFILE_IMAGE(PORT_PBCFG_PINS, OVERRIDES, PORTB), \
+		PORT_PROFILE_IMAGE(PORT_PBCFG_PINS, OVERRIDES, PORTC), \
+		PORT_PROFILE_IMAGE(PORT_PBCFG_PINS, OVERRIDES, PORTD), \
+		PORT_PROFILE_IMAGE(PORT_PBCFG_PINS, OVERRIDES, PORTE), \
+		PORT_PROFILE_IMAGE(PORT_PBCFG_PINS, OVERRIDES, PORTF) \
+	}}
+
+/* Deltas of all the ports for the switch between two profiles */
+#define PORT_PBCFG_DELTA(FROM, TO) \
+	{{ \
+		PORT_PROFILE_DELTA(PORT_PBCFG_PINS, FROM, TO, PORTA), \
+		PORT_PROFILE_DELTA(PORT_PBCFG_PINS, FROM, TO, PORTB), \
+		PORT_PROFILE_DELTA(PORT_PBCFG_PINS, FROM, TO, PORTC), \
+		PORT_PROFILE_DELTA(PORT_PBCFG_PINS, FROM, TO, PORTD), \
+		PORT_PROFILE_DELTA(PORT_PBCFG_PINS, FROM, TO, PORTE), \
+		PORT_PROFILE_DELTA(PORT_PBCFG_PINS, FROM, TO, PORTF) \
+	}}
+
+/* Deltas from one profile to all the profiles */
+#define PORT_PBCFG_DELTAS_FROM(FROM) \
+	{ \
+		PORT_PBCFG_DELTA(FROM, PORT_PBCFG_PROFILE_RUN), \
+		PORT_PBCFG_DELTA(FROM, PORT_PBCFG_PROFILE_DIAGNOSTIC), \
+		PORT_PBCFG_DELTA(FROM, PORT_PBCFG_PROFILE_LOW_POWER) \
+	}
+#endif
+
+#if (PORT_LOW_POWER_API == STD_ON)
+/* Pins which stay active in the low power mode: PF4 (SW1) wakes the MCU up, the other pins are parked */
+#define PORT_PBCFG_LOW_POWER_ACTIVE_PINS(X, ARG) \
+	X(ARG, PORT_PIN_05)
+#endif
+
+/*
+ * Compile-time validation of the pins lists: the range and the uniqueness of the pin IDs, the JTAG
+ * pins, the mode numbers and the internal resistors, and one entry for every configured channel
+ */
+PORT_CHECK_PINS_LIST(PORT_PBCFG_PINS, Port_PBcfg_Pins);
+STATIC_ASSERT((0U PORT_PBCFG_PINS(PORT_CHECK_COUNT_OF, 0U)) == PORT_CONFIGURED_CHANNLES, Port_PBcfg_Pins_count);
+
+#if (PORT_PROFILES_API == STD_ON)
+PORT_CHECK_PINS_LIST(PORT_PBCFG_PROFILE_RUN, Port_PBcfg_Profile_Run);
+PORT_CHECK_PINS_LIST(PORT_PBCFG_PROFILE_DIAGNOSTIC, Port_PBcfg_Profile_Diagnostic);
+PORT_CHECK_PINS_LIST(PORT_PBCFG_PROFILE_LOW_POWER, Port_PBcfg_Profile_Low_Power);
+#endif
+
+/* Expand one entry of the pins list into the configuration structure of the pin */
+#define PORT_PBCFG_CHANNEL(ARG, PIN, MODE, DIRECTION, INITIAL, DIRECTION_CHANGE, MODE_CHANGE, RESISTOR) \
+	{PIN, MODE, DIRECTION, INITIAL, DIRECTION_CHANGE, MODE_CHANGE, RESISTOR},
+
 /* PB structure used with Port_Init API */
 const Port_ConfigType Port_Configuration = 
 {
-		PORT_PIN_01, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_04, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, 
-		PORT_PIN_05, PORT_PIN_MODE_DIO, PORT_PIN_IN, INITIAL_VALUE, directionChangable_ON, modeChangable_ON, PULL_UP, 
-		PORT_PIN_06, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_07, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, 
-		PORT_PIN_08, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, 
-		PORT_PIN_09, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_10, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, 
-		PORT_PIN_13, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, 
-		PORT_PIN_14, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_15, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_16, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_17, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_18, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_19, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_20, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_21, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_22, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_23, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_24, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_28, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_OUT, INITIAL_VALUE, directionChangable_ON, modeChangable_ON, OFF,
-		PORT_PIN_30, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_31, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_43, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_44, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_45, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_46, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_47, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_48, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_49, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_50, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_51, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_52, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_53, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_57, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_58, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_59, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_60, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_61, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_62, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_63, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-		PORT_PIN_64, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR
+		/* Configuration of every pin */
+		{
+				PORT_PBCFG_PINS(PORT_PBCFG_CHANNEL, 0U)
+		},
+		/* Register images of the ports */
+		{
+				PORT_IMAGE(PORT_PBCFG_PINS, PORTA),
+				PORT_IMAGE(PORT_PBCFG_PINS, PORTB),
+				PORT_IMAGE(PORT_PBCFG_PINS, PORTC),
+				PORT_IMAGE(PORT_PBCFG_PINS, PORTD),
+				PORT_IMAGE(PORT_PBCFG_PINS, PORTE),
+				PORT_IMAGE(PORT_PBCFG_PINS, PORTF)
+		}
+#if (PORT_PROFILES_API == STD_ON)
+		,
+		/* Register images of the profiles, in the order of their IDs in Port_Cfg.h */
+		{
+				PORT_PBCFG_PROFILE(PORT_PBCFG_PROFILE_RUN),
+				PORT_PBCFG_PROFILE(PORT_PBCFG_PROFILE_DIAGNOSTIC),
+				PORT_PBCFG_PROFILE(PORT_PBCFG_PROFILE_LOW_POWER)
+		},
+		/* Deltas between every two profiles */
+		{
+				PORT_PBCFG_DELTAS_FROM(PORT_PBCFG_PROFILE_RUN),
+				PORT_PBCFG_DELTAS_FROM(PORT_PBCFG_PROFILE_DIAGNOSTIC),
+				PORT_PBCFG_DELTAS_FROM(PORT_PBCFG_PROFILE_LOW_POWER)
+		}
+#endif
+#if (PORT_LOW_POWER_API == STD_ON)
+		,
+		/* Pins of every port which stay active in the low power mode */
+		{
+				PORT_ACTIVE_PINS(PORT_PBCFG_LOW_POWER_ACTIVE_PINS, PORTA),
+				PORT_ACTIVE_PINS(PORT_PBCFG_LOW_POWER_ACTIVE_PINS, PORTB),
+				PORT_ACTIVE_PINS(PORT_PBCFG_LOW_POWER_ACTIVE_PINS, PORTC),
+				PORT_ACTIVE_PINS(PORT_PBCFG_LOW_POWER_ACTIVE_PINS, PORTD),
+				PORT_ACTIVE_PINS(PORT_PBCFG_LOW_POWER_ACTIVE_PINS, PORTE),
+				PORT_ACTIVE_PINS(PORT_PBCFG_LOW_POWER_ACTIVE_PINS, PORTF)
+		}
+#endif
 };
-
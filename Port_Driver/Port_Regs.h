@@ -16,6 +16,9 @@
 /* Standard AUTOSAR types */
 #include "Std_Types.h"
 
+/* Port Pre-Compile Configuration Header file (GPIO aperture of the ports) */
+#include "Port_Cfg.h"
+
 /*****************************************************************************
                             GPIO registers (PORTA)
  *****************************************************************************/
@@ -103,18 +106,39 @@
 /***************************************************************************/
 
 #define SYSCTL_REGCGC2_REG        (*((volatile uint32 *)0x400FE108))
+#define SYSCTL_GPIOHBCTL_REG      (*((volatile uint32 *)0x400FE06C))
 
 /*******************************************************************************
  *                              Port Definitions                              *
  *******************************************************************************/
 
+/* GPIO Registers base addresses on the APB aperture */
+#define GPIO_PORTA_APB_BASE_ADDRESS       0x40004000
+#define GPIO_PORTB_APB_BASE_ADDRESS       0x40005000
+#define GPIO_PORTC_APB_BASE_ADDRESS       0x40006000
+#define GPIO_PORTD_APB_BASE_ADDRESS       0x40007000
+#define GPIO_PORTE_APB_BASE_ADDRESS       0x40024000
+#define GPIO_PORTF_APB_BASE_ADDRESS       0x40025000
+
+/* GPIO Registers base addresses on the AHB aperture */
+#define GPIO_PORTA_AHB_BASE_ADDRESS       0x40058000
+#define GPIO_PORTB_AHB_BASE_ADDRESS       0x40059000
+#define GPIO_PORTC_AHB_BASE_ADDRESS       0x4005A000
+#define GPIO_PORTD_AHB_BASE_ADDRESS       0x4005B000
+#define GPIO_PORTE_AHB_BASE_ADDRESS       0x4005C000
+#define GPIO_PORTF_AHB_BASE_ADDRESS       0x4005D000
+
+/* Base address of a port in the aperture selected for it by PORT_AHB_PORTS_MASK */
+#define PORT_APERTURE_BASE(PORT_NUM,APB,AHB) \
+	((((PORT_AHB_PORTS_MASK) >> (PORT_NUM)) & 1U) ? (AHB) : (APB))
+
 /* GPIO Registers base addresses */
-#define GPIO_PORTA_BASE_ADDRESS           0x40004000
-#define GPIO_PORTB_BASE_ADDRESS           0x40005000
-#define GPIO_PORTC_BASE_ADDRESS           0x40006000
-#define GPIO_PORTD_BASE_ADDRESS           0x40007000
-#define GPIO_PORTE_BASE_ADDRESS           0x40024000
-#define GPIO_PORTF_BASE_ADDRESS           0x40025000
+#define GPIO_PORTA_BASE_ADDRESS           PORT_APERTURE_BASE(0U, GPIO_PORTA_APB_BASE_ADDRESS, GPIO_PORTA_AHB_BASE_ADDRESS)
+#define GPIO_PORTB_BASE_ADDRESS           PORT_APERTURE_BASE(1U, GPIO_PORTB_APB_BASE_ADDRESS, GPIO_PORTB_AHB_BASE_ADDRESS)
+#define GPIO_PORTC_BASE_ADDRESS           PORT_APERTURE_BASE(2U, GPIO_PORTC_APB_BASE_ADDRESS, GPIO_PORTC_AHB_BASE_ADDRESS)
+#define GPIO_PORTD_BASE_ADDRESS           PORT_APERTURE_BASE(3U, GPIO_PORTD_APB_BASE_ADDRESS, GPIO_PORTD_AHB_BASE_ADDRESS)
+#define GPIO_PORTE_BASE_ADDRESS           PORT_APERTURE_BASE(4U, GPIO_PORTE_APB_BASE_ADDRESS, GPIO_PORTE_AHB_BASE_ADDRESS)
+#define GPIO_PORTF_BASE_ADDRESS           PORT_APERTURE_BASE(5U, GPIO_PORTF_APB_BASE_ADDRESS, GPIO_PORTF_AHB_BASE_ADDRESS)
 
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
@@ -0,0 +1,32 @@
+# Compare the register dumps of two Port_Dump variants:
+#   cmake -DREFERENCE=<port_dump> -DVARIANT=<port_dump variant> [-DMAX_REFERENCE_ACCESSES=<n>]
+#         [-DFEWER_ACCESSES=ON] -P Compare_Dumps.cmake
+# The registers of both dumps must be identical. MAX_REFERENCE_ACCESSES bounds the register
+# accesses of the reference Port_Init, FEWER_ACCESSES requires it to be below the variant's one.
+
+foreach(program REFERENCE VARIANT)
+	execute_process(COMMAND ${${program}} OUTPUT_VARIABLE dump_${program} RESULT_VARIABLE result)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "${${program}} failed: ${result}")
+	endif()
+	string(REGEX MATCH "accesses Port_Init ([0-9]+)" match "${dump_${program}}")
+	set(accesses_${program} ${CMAKE_MATCH_1})
+	string(REGEX REPLACE "accesses Port_Init [0-9]+\n" "" dump_${program} "${dump_${program}}")
+	message(STATUS "${${program}}: Port_Init ${accesses_${program}} register accesses")
+endforeach()
+
+if(NOT dump_REFERENCE STREQUAL dump_VARIANT)
+	file(WRITE ${CMAKE_CURRENT_BINARY_DIR}/reference.txt "${dump_REFERENCE}")
+	file(WRITE ${CMAKE_CURRENT_BINARY_DIR}/variant.txt "${dump_VARIANT}")
+	execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files
+		${CMAKE_CURRENT_BINARY_DIR}/reference.txt ${CMAKE_CURRENT_BINARY_DIR}/variant.txt)
+	message(FATAL_ERROR "The registers differ, see reference.txt and variant.txt in ${CMAKE_CURRENT_BINARY_DIR}")
+endif()
+
+if(DEFINED MAX_REFERENCE_ACCESSES AND accesses_REFERENCE GREATER MAX_REFERENCE_ACCESSES)
+	message(FATAL_ERROR "Port_Init: ${accesses_REFERENCE} register accesses, at most ${MAX_REFERENCE_ACCESSES} expected")
+endif()
+
+if(FEWER_ACCESSES AND NOT accesses_REFERENCE LESS accesses_VARIANT)
+	message(FATAL_ERROR "Port_Init: ${accesses_REFERENCE} register accesses, fewer than ${accesses_VARIANT} expected")
+endif()
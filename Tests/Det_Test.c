@@ -0,0 +1,188 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Det_Test.c
+ *
+ * Description: Host test of the error counters of the Det. The Det is built with
+ *              DET_REPORT_CALLOUT_FUNCTION = Test_DetCallout which records the reports of
+ *              Det_MainFunction. The Det has no init service: the test cases run in this order
+ *              on the same counters and every case uses its own module ID.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#include "Test_Check.h"
+#include "Det.h"
+
+/* Module IDs of the test cases */
+#define TEST_FIRST_ERRORS_MODULE_ID   (200U)
+#define TEST_PROBING_MODULE_ID        (201U)
+#define TEST_SATURATION_MODULE_ID     (202U)
+#define TEST_CALLOUT_MODULE_ID        (203U)
+
+/* Maximum number of the recorded callouts */
+#define TEST_CALLOUTS_SIZE            (DET_COUNTERS_SIZE)
+
+/* Callout recorded from Det_MainFunction */
+typedef struct
+{
+	Det_ErrorType Error;
+	uint16 Count;
+} Test_CalloutType;
+
+STATIC Test_CalloutType Test_Callouts[TEST_CALLOUTS_SIZE];
+STATIC uint8 Test_CalloutsCount = 0U;
+
+/************************************************************************************
+ * Function Name: Test_DetCallout
+ * Parameters (in): ModuleId, InstanceId, ApiId, ErrorId - The reported error
+ *                  Count - Number of the new reports of the error
+ * Return value: None
+ * Description: DET_REPORT_CALLOUT of the test, records the reports of Det_MainFunction.
+ ************************************************************************************/
+void Test_DetCallout(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId, uint16 Count)
+{
+	Test_CalloutType * callout;
+
+	if (Test_CalloutsCount < TEST_CALLOUTS_SIZE)
+	{
+		callout = &Test_Callouts[Test_CalloutsCount];
+		callout->Error.ModuleId = ModuleId;
+		callout->Error.InstanceId = InstanceId;
+		callout->Error.ApiId = ApiId;
+		callout->Error.ErrorId = ErrorId;
+		callout->Count = Count;
+	}
+	Test_CalloutsCount++;
+}
+
+/************************************************************************************
+ * Function Name: Test_report
+ * Parameters (in): ModuleId, ApiId, ErrorId - The error
+ *                  Times - Number of the reports
+ * Return value: None
+ * Description: Report an error a number of times.
+ ************************************************************************************/
+STATIC void Test_report(uint16 ModuleId, uint8 ApiId, uint8 ErrorId, uint32 Times)
+{
+	uint32 time;
+
+	for (time = 0U; time < Times; time++)
+	{
+		(void)Det_ReportError(ModuleId, 0U, ApiId, ErrorId);
+	}
+}
+
+/************************************************************************************
+ * Function Name: Test_FirstErrors
+ * Description: The log keeps the first DET_FIRST_ERRORS_SIZE distinct errors in the order
+ *              of their first report, a repeated error is not logged again.
+ ************************************************************************************/
+STATIC void Test_FirstErrors(void)
+{
+	Det_ErrorType errors[DET_FIRST_ERRORS_SIZE + 1U];
+	uint8 error;
+
+	for (error = 0U; error <= DET_FIRST_ERRORS_SIZE; error++)
+	{
+		Test_report(TEST_FIRST_ERRORS_MODULE_ID, 1U, error, 1U);
+		Test_report(TEST_FIRST_ERRORS_MODULE_ID, 1U, 0U, 1U);
+	}
+
+	TEST_CHECK_EQUAL(Det_GetFirstErrors(errors, DET_FIRST_ERRORS_SIZE + 1U), DET_FIRST_ERRORS_SIZE);
+	for (error = 0U; error < DET_FIRST_ERRORS_SIZE; error++)
+	{
+		TEST_CHECK_EQUAL(errors[error].ModuleId, TEST_FIRST_ERRORS_MODULE_ID);
+		TEST_CHECK_EQUAL(errors[error].ApiId, 1U);
+		TEST_CHECK_EQUAL(errors[error].ErrorId, error);
+	}
+
+	/* A smaller buffer takes the oldest errors */
+	TEST_CHECK_EQUAL(Det_GetFirstErrors(errors, 2U), 2U);
+	TEST_CHECK_EQUAL(errors[1].ErrorId, 1U);
+
+	/* The errors after the log is full are still counted */
+	TEST_CHECK_EQUAL(Det_GetErrorCount(TEST_FIRST_ERRORS_MODULE_ID, 1U, 0U), DET_FIRST_ERRORS_SIZE + 2U);
+	TEST_CHECK_EQUAL(Det_GetErrorCount(TEST_FIRST_ERRORS_MODULE_ID, 1U, DET_FIRST_ERRORS_SIZE), 1U);
+}
+
+/************************************************************************************
+ * Function Name: Test_Probing
+ * Description: Errors with the same first probed counter get their own counters.
+ ************************************************************************************/
+STATIC void Test_Probing(void)
+{
+	/* {API 1, error 2}, {API 2, error 1} and {API 3, error 0} of one module share the first probed counter */
+	Test_report(TEST_PROBING_MODULE_ID, 1U, 2U, 3U);
+	Test_report(TEST_PROBING_MODULE_ID, 2U, 1U, 2U);
+
+	TEST_CHECK_EQUAL(Det_GetErrorCount(TEST_PROBING_MODULE_ID, 1U, 2U), 3U);
+	TEST_CHECK_EQUAL(Det_GetErrorCount(TEST_PROBING_MODULE_ID, 2U, 1U), 2U);
+	TEST_CHECK_EQUAL(Det_GetErrorCount(TEST_PROBING_MODULE_ID, 3U, 0U), 0U);
+
+	Test_report(TEST_PROBING_MODULE_ID, 3U, 0U, 1U);
+	TEST_CHECK_EQUAL(Det_GetErrorCount(TEST_PROBING_MODULE_ID, 3U, 0U), 1U);
+	TEST_CHECK_EQUAL(Det_GetErrorCount(TEST_PROBING_MODULE_ID, 1U, 2U), 3U);
+}
+
+/************************************************************************************
+ * Function Name: Test_Saturation
+ * Description: A counter saturates at 0xFFFF while the total of the errors keeps counting.
+ ************************************************************************************/
+STATIC void Test_Saturation(void)
+{
+	uint32 total = Det_GetLastError(NULL_PTR);
+
+	Test_report(TEST_SATURATION_MODULE_ID, 1U, 1U, 0xFFFFUL + 5UL);
+	TEST_CHECK_EQUAL(Det_GetErrorCount(TEST_SATURATION_MODULE_ID, 1U, 1U), 0xFFFFU);
+	TEST_CHECK_EQUAL(Det_GetLastError(NULL_PTR), total + 0xFFFFUL + 5UL);
+}
+
+/************************************************************************************
+ * Function Name: Test_MainFunctionDelta
+ * Description: Det_MainFunction reports every error counted since its previous call once,
+ *              with the number of its new reports.
+ ************************************************************************************/
+STATIC void Test_MainFunctionDelta(void)
+{
+	/* Report the errors of the previous test cases */
+	Det_MainFunction();
+	Test_CalloutsCount = 0U;
+
+	Test_report(TEST_CALLOUT_MODULE_ID, 1U, 1U, 3U);
+	Test_report(TEST_CALLOUT_MODULE_ID, 2U, 5U, 1U);
+	Det_MainFunction();
+	TEST_CHECK_EQUAL(Test_CalloutsCount, 2U);
+	TEST_CHECK_EQUAL(Test_Callouts[0].Error.ModuleId, TEST_CALLOUT_MODULE_ID);
+	TEST_CHECK_EQUAL(Test_Callouts[0].Count + Test_Callouts[1].Count, 4U);
+	TEST_CHECK_EQUAL((Test_Callouts[0].Error.ApiId == 1U) ? Test_Callouts[0].Count : Test_Callouts[1].Count, 3U);
+	TEST_CHECK_EQUAL((Test_Callouts[0].Error.ApiId == 2U) ? Test_Callouts[0].Error.ErrorId : Test_Callouts[1].Error.ErrorId, 5U);
+
+	/* Only the new reports of the error */
+	Test_CalloutsCount = 0U;
+	Test_report(TEST_CALLOUT_MODULE_ID, 1U, 1U, 2U);
+	Det_MainFunction();
+	TEST_CHECK_EQUAL(Test_CalloutsCount, 1U);
+	TEST_CHECK_EQUAL(Test_Callouts[0].Error.ApiId, 1U);
+	TEST_CHECK_EQUAL(Test_Callouts[0].Count, 2U);
+
+	/* Nothing new, and a saturated counter does not change any more */
+	Test_CalloutsCount = 0U;
+	Test_report(TEST_SATURATION_MODULE_ID, 1U, 1U, 1U);
+	Det_MainFunction();
+	TEST_CHECK_EQUAL(Test_CalloutsCount, 0U);
+}
+
+STATIC const Test_CaseType Test_Cases[] =
+{
+	{"first errors log",                Test_FirstErrors},
+	{"probing of the counters",         Test_Probing},
+	{"saturation of the counters",      Test_Saturation},
+	{"Det_MainFunction new reports",    Test_MainFunctionDelta},
+};
+
+int main(void)
+{
+	return TEST_RUN(Test_Cases);
+}
@@ -0,0 +1,309 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Dio_Test.c
+ *
+ * Description: Host test of the Dio driver over the simulated registers.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#include "Test_Check.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Det.h"
+
+/* Aperture selection register of the GPIO ports */
+#define TEST_SYSCTL_GPIOHBCTL         (0x400FE06CUL)
+
+/*
+ * Configuration with a channel on PE3 while PORTE is not a configured Dio port: the debouncing
+ * shall sample the ports of the channels, not only the configured ports
+ */
+STATIC const Dio_ConfigType Test_DioOtherPortConfiguration =
+{
+	{
+		{TEST_PORTE, 3U, DIO_EDGE_NONE, STD_HIGH, DIO_CHANNEL_DATA_ADDRESS(TEST_PORTE, 3U), DIO_CHANNEL_MASK(3U)},
+		{TEST_PORTF, 4U, DIO_EDGE_NONE, STD_LOW, DIO_CHANNEL_DATA_ADDRESS(TEST_PORTF, 4U), DIO_CHANNEL_MASK(4U)}
+	},
+	{
+		{TEST_PORTF, DIO_PORT_DATA_ADDRESS(TEST_PORTF)}
+	},
+	{
+		{DioConf_RGB_LED_GROUP_MASK, DioConf_RGB_LED_GROUP_OFFSET, TEST_PORTF,
+				DIO_MASKED_DATA_ADDRESS(TEST_PORTF, DioConf_RGB_LED_GROUP_MASK)}
+	}
+};
+
+/* Configuration with the soft PWM channels on PF1 (LED1) and PF2 (blue led) */
+STATIC const Dio_ConfigType Test_DioPwmConfiguration =
+{
+	{
+		{TEST_PORTF, 1U, DIO_EDGE_NONE, STD_HIGH, DIO_CHANNEL_DATA_ADDRESS(TEST_PORTF, 1U), DIO_CHANNEL_MASK(1U)},
+		{TEST_PORTF, 2U, DIO_EDGE_NONE, STD_HIGH, DIO_CHANNEL_DATA_ADDRESS(TEST_PORTF, 2U), DIO_CHANNEL_MASK(2U)}
+	},
+	{
+		{TEST_PORTF, DIO_PORT_DATA_ADDRESS(TEST_PORTF)}
+	},
+	{
+		{DioConf_RGB_LED_GROUP_MASK, DioConf_RGB_LED_GROUP_OFFSET, TEST_PORTF,
+				DIO_MASKED_DATA_ADDRESS(TEST_PORTF, DioConf_RGB_LED_GROUP_MASK)}
+	}
+};
+
+/* Duty cycles of the soft PWM: 25 % and 78 % of the period */
+#define TEST_PWM_DUTY_25              ((uint16)((DIO_SOFT_PWM_PERIOD * 25U) / 100U))
+#define TEST_PWM_DUTY_78              ((uint16)(((DIO_SOFT_PWM_PERIOD * 78U) + 50U) / 100U))
+
+/* Soft PWM activity: the timer ticks run, of every channel at high level, the delays returned by the interrupt */
+typedef struct
+{
+	uint16 Elapsed;
+	uint16 HighTicks[2];
+	uint16 Delays[3];
+	uint8 Calls;
+} Test_PwmActivityType;
+
+/************************************************************************************
+ * Function Name: Test_pwmClear
+ * Parameters (out): Activity - Activity to be cleared
+ * Return value: None
+ * Description: Clear the soft PWM activity before a new period.
+ ************************************************************************************/
+STATIC void Test_pwmClear(Test_PwmActivityType * Activity)
+{
+	uint8 index;
+
+	Activity->Elapsed = 0U;
+	Activity->Calls = 0U;
+	for (index = 0U; index < 3U; index++)
+	{
+		Activity->Delays[index] = 0U;
+	}
+	Activity->HighTicks[0] = 0U;
+	Activity->HighTicks[1] = 0U;
+}
+
+/************************************************************************************
+ * Function Name: Test_pwmRun
+ * Parameters (in): Calls - Number of the timer interrupts
+ * Parameters (inout): Activity - Activity of the soft PWM
+ * Return value: None
+ * Description: Run Dio_SoftPwmIsr as the timer interrupt does, the levels of PF1 and PF2 after
+ *              every call hold for the returned number of ticks.
+ ************************************************************************************/
+STATIC void Test_pwmRun(uint8 Calls, Test_PwmActivityType * Activity)
+{
+	uint16 delay;
+	uint8 call;
+
+	for (call = 0U; call < Calls; call++)
+	{
+		delay = Dio_SoftPwmIsr();
+		if (Activity->Calls < 3U)
+		{
+			Activity->Delays[Activity->Calls] = delay;
+		}
+		Activity->Calls++;
+		Activity->Elapsed += delay;
+		Activity->HighTicks[0] += (STD_HIGH == RegSim_GetPinLevel(TEST_PORTF, 1U)) ? delay : 0U;
+		Activity->HighTicks[1] += (STD_HIGH == RegSim_GetPinLevel(TEST_PORTF, 2U)) ? delay : 0U;
+	}
+}
+
+/************************************************************************************
+ * Function Name: Test_debounce
+ * Parameters (in): Ticks - Number of the debounce ticks
+ * Return value: None
+ * Description: Run the debouncing for a number of ticks.
+ ************************************************************************************/
+STATIC void Test_debounce(uint8 Ticks)
+{
+	uint8 tick;
+
+	for (tick = 0U; tick < Ticks; tick++)
+	{
+		Dio_DebounceMainFunction();
+	}
+}
+
+/************************************************************************************
+ * Function Name: Test_DebounceConfiguredPort
+ * Description: A press of SW1 (PF4, active low) is debounced and latched once.
+ ************************************************************************************/
+STATIC void Test_DebounceConfiguredPort(void)
+{
+	Port_Init(&Port_Configuration);
+	RegSim_SetPinLevel(TEST_PORTF, 4U, STD_HIGH);
+	Dio_Init(&Dio_Configuration);
+	TEST_CHECK_EQUAL(Dio_GetDebouncedLevel(DioConf_SW1_CHANNEL_ID_INDEX), STD_HIGH);
+
+	RegSim_SetPinLevel(TEST_PORTF, 4U, STD_LOW);
+	Test_debounce(DIO_DEBOUNCE_SAMPLES - 1U);
+	TEST_CHECK_EQUAL(Dio_GetDebouncedLevel(DioConf_SW1_CHANNEL_ID_INDEX), STD_HIGH);
+	Test_debounce(1U);
+	TEST_CHECK_EQUAL(Dio_GetDebouncedLevel(DioConf_SW1_CHANNEL_ID_INDEX), STD_LOW);
+	TEST_CHECK_EQUAL(Dio_GetDebounceEvent(DioConf_SW1_CHANNEL_ID_INDEX), DIO_DEBOUNCE_PRESSED);
+	TEST_CHECK_EQUAL(Dio_GetDebounceEvent(DioConf_SW1_CHANNEL_ID_INDEX), DIO_DEBOUNCE_NO_EVENT);
+}
+
+/************************************************************************************
+ * Function Name: Test_DebounceOtherPort
+ * Description: A channel on a port which is not a configured Dio port is debounced too.
+ ************************************************************************************/
+STATIC void Test_DebounceOtherPort(void)
+{
+	Port_Init(&Port_Configuration);
+	Dio_Init(&Test_DioOtherPortConfiguration);
+	TEST_CHECK_EQUAL(Dio_GetDebouncedLevel(0U), STD_LOW);
+
+	RegSim_SetPinLevel(TEST_PORTE, 3U, STD_HIGH);
+	Test_debounce(DIO_DEBOUNCE_SAMPLES);
+	TEST_CHECK_EQUAL(Dio_GetDebouncedLevel(0U), STD_HIGH);
+	TEST_CHECK_EQUAL(Dio_GetDebounceEvent(0U), DIO_DEBOUNCE_PRESSED);
+
+	/* The default configuration is restored for the other test cases */
+	Dio_Init(&Dio_Configuration);
+}
+
+/************************************************************************************
+ * Function Name: Test_ApertureMismatch
+ * Description: Dio_Init reports DIO_E_PARAM_APERTURE when the GPIO apertures selected in
+ *              GPIOHBCTL differ from DIO_AHB_PORTS_MASK, and nothing when they match.
+ ************************************************************************************/
+STATIC void Test_ApertureMismatch(void)
+{
+	uint16 errors = Det_GetErrorCount(DIO_MODULE_ID, DIO_INIT_SID, DIO_E_PARAM_APERTURE);
+
+	Port_Init(&Port_Configuration);
+	Dio_Init(&Dio_Configuration);
+	TEST_CHECK_EQUAL(Det_GetErrorCount(DIO_MODULE_ID, DIO_INIT_SID, DIO_E_PARAM_APERTURE), errors);
+
+	/* PORTF moved to the other aperture behind the Dio configuration */
+	REG_WRITE32(TEST_REG(TEST_SYSCTL_GPIOHBCTL), RegSim_Peek32(TEST_SYSCTL_GPIOHBCTL) ^ 0x20U);
+	Dio_Init(&Dio_Configuration);
+	TEST_CHECK_EQUAL(Det_GetErrorCount(DIO_MODULE_ID, DIO_INIT_SID, DIO_E_PARAM_APERTURE), errors + 1U);
+}
+
+/************************************************************************************
+ * Function Name: Test_SoftPwm
+ * Description: One period of the soft PWM gives the exact high time of every duty cycle with
+ *              one store per transition, and a duty changed in the middle of a period takes
+ *              effect at the start of the next period only.
+ ************************************************************************************/
+STATIC void Test_SoftPwm(void)
+{
+	Test_PwmActivityType activity;
+	RegSim_StatsType stats;
+
+	Port_Init(&Port_Configuration);
+	Dio_Init(&Test_DioPwmConfiguration);
+	Dio_SoftPwmSetDuty(0U, TEST_PWM_DUTY_25);
+	Dio_SoftPwmSetDuty(1U, TEST_PWM_DUTY_78);
+
+	/* Period start, end of the PF1 high time, end of the PF2 high time */
+	Test_pwmClear(&activity);
+	RegSim_ClearStats();
+	Test_pwmRun(3U, &activity);
+	RegSim_GetStats(&stats);
+	TEST_CHECK_EQUAL(activity.Elapsed, DIO_SOFT_PWM_PERIOD);
+	TEST_CHECK_EQUAL(activity.Delays[0], TEST_PWM_DUTY_25);
+	TEST_CHECK_EQUAL(activity.Delays[1], TEST_PWM_DUTY_78 - TEST_PWM_DUTY_25);
+	TEST_CHECK_EQUAL(activity.Delays[2], DIO_SOFT_PWM_PERIOD - TEST_PWM_DUTY_78);
+	TEST_CHECK_EQUAL(activity.HighTicks[0], TEST_PWM_DUTY_25);
+	TEST_CHECK_EQUAL(activity.HighTicks[1], TEST_PWM_DUTY_78);
+	TEST_CHECK_EQUAL(stats.Writes, 3U);
+
+	/* PF1 goes to 50 % after the start of a period: this period keeps 25 % */
+	Test_pwmClear(&activity);
+	Test_pwmRun(1U, &activity);
+	Dio_SoftPwmSetDuty(0U, DIO_SOFT_PWM_PERIOD / 2U);
+	Test_pwmRun(2U, &activity);
+	TEST_CHECK_EQUAL(activity.Elapsed, DIO_SOFT_PWM_PERIOD);
+	TEST_CHECK_EQUAL(activity.HighTicks[0], TEST_PWM_DUTY_25);
+	TEST_CHECK_EQUAL(activity.HighTicks[1], TEST_PWM_DUTY_78);
+
+	/* The next period runs the new schedule */
+	Test_pwmClear(&activity);
+	Test_pwmRun(3U, &activity);
+	TEST_CHECK_EQUAL(activity.Elapsed, DIO_SOFT_PWM_PERIOD);
+	TEST_CHECK_EQUAL(activity.Delays[0], DIO_SOFT_PWM_PERIOD / 2U);
+	TEST_CHECK_EQUAL(activity.HighTicks[0], DIO_SOFT_PWM_PERIOD / 2U);
+	TEST_CHECK_EQUAL(activity.HighTicks[1], TEST_PWM_DUTY_78);
+
+	/* The default configuration is restored for the other test cases */
+	Dio_Init(&Dio_Configuration);
+}
+
+/************************************************************************************
+ * Function Name: Test_edge
+ * Parameters (in): Level - New level of SW1
+ * Return value: None
+ * Description: Drive SW1 (PF4) to a new level and run the interrupt handler of PORTF.
+ ************************************************************************************/
+STATIC void Test_edge(Dio_LevelType Level)
+{
+	RegSim_SetPinLevel(TEST_PORTF, 4U, Level);
+	Dio_EdgeIsr(TEST_PORTF);
+}
+
+/************************************************************************************
+ * Function Name: Test_EdgeQueue
+ * Description: The edges of SW1 are read in their order with the level after the edge, and
+ *              the edges which find the queue full are counted as overflows.
+ ************************************************************************************/
+STATIC void Test_EdgeQueue(void)
+{
+	Dio_EdgeEventType event;
+	uint8 edge;
+
+	Port_Init(&Port_Configuration);
+	RegSim_SetPinLevel(TEST_PORTF, 4U, STD_HIGH);
+	Dio_Init(&Dio_Configuration);
+
+	/* Press and release, an interrupt with no pending edge adds nothing */
+	Test_edge(STD_LOW);
+	Test_edge(STD_HIGH);
+	Dio_EdgeIsr(TEST_PORTF);
+	TEST_CHECK_EQUAL(Dio_GetEdgeEvent(&event), E_OK);
+	TEST_CHECK_EQUAL(event.Channel, DioConf_SW1_CHANNEL_ID_INDEX);
+	TEST_CHECK_EQUAL(event.Level, STD_LOW);
+	TEST_CHECK_EQUAL(Dio_GetEdgeEvent(&event), E_OK);
+	TEST_CHECK_EQUAL(event.Channel, DioConf_SW1_CHANNEL_ID_INDEX);
+	TEST_CHECK_EQUAL(event.Level, STD_HIGH);
+	TEST_CHECK_EQUAL(Dio_GetEdgeEvent(&event), E_NOT_OK);
+
+	/* One edge more than the queue holds: the last one is lost */
+	for (edge = 0U; edge <= DIO_EDGE_QUEUE_SIZE; edge++)
+	{
+		Test_edge(((edge & 1U) == 0U) ? STD_LOW : STD_HIGH);
+	}
+	TEST_CHECK_EQUAL(Dio_GetEdgeOverflows(), 1U);
+	for (edge = 0U; edge < DIO_EDGE_QUEUE_SIZE; edge++)
+	{
+		TEST_CHECK_EQUAL(Dio_GetEdgeEvent(&event), E_OK);
+		TEST_CHECK_EQUAL(event.Level, ((edge & 1U) == 0U) ? STD_LOW : STD_HIGH);
+	}
+	TEST_CHECK_EQUAL(Dio_GetEdgeEvent(&event), E_NOT_OK);
+
+	/* The queue takes new edges again (SW1 is low after the odd number of edges) */
+	Test_edge(STD_HIGH);
+	TEST_CHECK_EQUAL(Dio_GetEdgeEvent(&event), E_OK);
+	TEST_CHECK_EQUAL(event.Level, STD_HIGH);
+	TEST_CHECK_EQUAL(Dio_GetEdgeOverflows(), 1U);
+}
+
+STATIC const Test_CaseType Test_Cases[] =
+{
+	{"debounce of a configured port",   Test_DebounceConfiguredPort},
+	{"debounce of a channel port only", Test_DebounceOtherPort},
+	{"Dio_Init aperture check",         Test_ApertureMismatch},
+	{"soft PWM period and duty update", Test_SoftPwm},
+	{"edge queue order and overflow",   Test_EdgeQueue},
+};
+
+int main(void)
+{
+	return TEST_RUN(Test_Cases);
+}
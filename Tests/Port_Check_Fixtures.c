@@ -0,0 +1,58 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Port_Check_Fixtures.c
+ *
+ * Description: Pins lists checked by PORT_CHECK_PINS_LIST at compile time. Without any
+ *              TEST_FIXTURE_* define the list is valid and the file compiles, every
+ *              TEST_FIXTURE_* define selects a list which breaks exactly one check and the
+ *              compiler shall report its static_assert_Test_Fixture_<check> array.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#include "Port.h"
+
+/* X(ARG, pin ID, mode, direction, initial value, direction changeable, mode changeable, internal resistor) */
+#if defined(TEST_FIXTURE_PIN_OUT_OF_RANGE)
+/* A pin ID after PF4 */
+#define TEST_FIXTURE_PINS(X, ARG) \
+	X(ARG, PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_OUT, STD_LOW, directionChangable_ON, modeChangable_ON, OFF) \
+	X(ARG, (PORTF_END_PIN + 1U), PORT_PIN_MODE_DIO, PORT_PIN_IN, STD_LOW, directionChangable_OFF, modeChangable_OFF, OFF)
+
+#elif defined(TEST_FIXTURE_DUPLICATE_PIN)
+/* PF1 listed twice */
+#define TEST_FIXTURE_PINS(X, ARG) \
+	X(ARG, PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_OUT, STD_LOW, directionChangable_ON, modeChangable_ON, OFF) \
+	X(ARG, PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_IN, STD_LOW, directionChangable_OFF, modeChangable_OFF, OFF)
+
+#elif defined(TEST_FIXTURE_CHANGEABLE_JTAG_PIN)
+/* PC3 (TDO/SWO) with a changeable direction */
+#define TEST_FIXTURE_PINS(X, ARG) \
+	X(ARG, PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_OUT, STD_LOW, directionChangable_ON, modeChangable_ON, OFF) \
+	X(ARG, PORT_PIN_49, PORT_PIN_MODE_DIO, PORT_PIN_IN, STD_LOW, directionChangable_ON, modeChangable_OFF, OFF)
+
+#elif defined(TEST_FIXTURE_INVALID_MODE)
+/* Mode 12 is neither a PMCx value of the data sheet nor ADC */
+#define TEST_FIXTURE_PINS(X, ARG) \
+	X(ARG, PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_OUT, STD_LOW, directionChangable_ON, modeChangable_ON, OFF) \
+	X(ARG, PORT_PIN_30, 12U, PORT_PIN_OUT, STD_LOW, directionChangable_OFF, modeChangable_OFF, OFF)
+
+#elif defined(TEST_FIXTURE_RESISTOR_ON_OUTPUT)
+/* An output with a pull-up */
+#define TEST_FIXTURE_PINS(X, ARG) \
+	X(ARG, PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_OUT, STD_LOW, directionChangable_ON, modeChangable_ON, PULL_UP)
+
+#else
+/* Valid list next to the limits of every check: first and last pin, unchangeable JTAG pin, ADC, PMC 9 (C0o on PF0) and last mode, pulled input */
+#define TEST_FIXTURE_PINS(X, ARG) \
+	X(ARG, PORTA_FIRST_PIN, PORT_PIN_MODE_DIO, PORT_PIN_IN, STD_LOW, directionChangable_ON, modeChangable_ON, PULL_DOWN) \
+	X(ARG, PORT_PIN_49, PORT_PIN_MODE_DIO, PORT_PIN_IN, STD_LOW, directionChangable_OFF, modeChangable_OFF, OFF) \
+	X(ARG, PORT_PIN_06, PORT_PIN_MODE_ADC, PORT_PIN_IN, STD_LOW, directionChangable_OFF, modeChangable_OFF, OFF) \
+	X(ARG, PORTF_FIRST_PIN, MAXIMUM_MODE_NUMBER, PORT_PIN_OUT, STD_LOW, directionChangable_OFF, modeChangable_OFF, OFF) \
+	X(ARG, PORT_PIN_29, LAST_MODE_NUMBER, PORT_PIN_OUT, STD_LOW, directionChangable_ON, modeChangable_ON, OFF) \
+	X(ARG, PORTF_END_PIN, PORT_PIN_MODE_DIO, PORT_PIN_IN, STD_LOW, directionChangable_ON, modeChangable_ON, PULL_UP)
+#endif
+
+PORT_CHECK_PINS_LIST(TEST_FIXTURE_PINS, Test_Fixture);
@@ -0,0 +1,85 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Port_Dump.c
+ *
+ * Description: Dump of the simulated GPIO registers after Port_Init and after a sequence of
+ *              Port_SetPinDirection / Port_SetPinMode calls. It is built against the
+ *              pre-compile variants of the Port driver (batched or per pin Port_Init, bit-band
+ *              or read-modify-write single bit updates) and Compare_Dumps.cmake checks that
+ *              all the variants leave the same registers.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "Test_Sim.h"
+#include "Port.h"
+
+/* Number of the GPIO ports */
+#define TEST_PORTS_NUM                (6U)
+
+/* Registers of the dump */
+STATIC const struct
+{
+	const char * Name;
+	uint32 Offset;
+} Test_DumpRegs[] =
+{
+	{"DATA",  TEST_GPIO_DATA},
+	{"DIR",   TEST_GPIO_DIR},
+	{"AFSEL", TEST_GPIO_AFSEL},
+	{"PUR",   TEST_GPIO_PUR},
+	{"PDR",   TEST_GPIO_PDR},
+	{"DEN",   TEST_GPIO_DEN},
+	{"AMSEL", TEST_GPIO_AMSEL},
+	{"PCTL",  TEST_GPIO_PCTL},
+};
+
+/************************************************************************************
+ * Function Name: Test_dump
+ * Parameters (in): Step - Name of the dumped step
+ * Return value: None
+ * Description: Print the GPIO registers of every port, one line per register.
+ ************************************************************************************/
+STATIC void Test_dump(const char * Step)
+{
+	uint8 port;
+	uint8 reg;
+
+	for (port = 0U; port < TEST_PORTS_NUM; port++)
+	{
+		for (reg = 0U; reg < (uint8)(sizeof(Test_DumpRegs) / sizeof(Test_DumpRegs[0])); reg++)
+		{
+			printf("%s PORT%c %-5s 0x%08lX\n", Step, 'A' + port, Test_DumpRegs[reg].Name,
+					(unsigned long)RegSim_Peek32(TEST_GPIO_REG(port, Test_DumpRegs[reg].Offset)));
+		}
+	}
+}
+
+int main(void)
+{
+	RegSim_StatsType stats;
+
+	RegSim_Reset();
+	Port_Init(&Port_Configuration);
+	RegSim_GetStats(&stats);
+	/* The access counts differ between the variants, Compare_Dumps.cmake checks them apart */
+	printf("accesses Port_Init %lu\n", (unsigned long)(stats.Reads + stats.Writes));
+	printf("faults %lu\n", (unsigned long)stats.Faults);
+	Test_dump("init");
+
+	/* Single bit updates of PORTF: SW1 (PF4) and LED1 (PF1) */
+	Port_SetPinDirection(PORT_PIN_05, PORT_PIN_OUT);
+	Port_SetPinMode(PORT_PIN_29, 1U);
+	Test_dump("set");
+	Port_SetPinDirection(PORT_PIN_05, PORT_PIN_IN);
+	Port_SetPinMode(PORT_PIN_29, PORT_PIN_MODE_DIO);
+	Test_dump("restore");
+
+	RegSim_GetStats(&stats);
+	printf("faults %lu\n", (unsigned long)stats.Faults);
+	return 0;
+}
@@ -0,0 +1,389 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Port_Test.c
+ *
+ * Description: Host test of the Port driver services over the simulated registers.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#include "Test_Check.h"
+#include "Port.h"
+#include "Det.h"
+
+/* Pins of PORTF: SW1 (PF4, pull-up input) and LED1 (PF1, output) */
+#define TEST_PF1                      (0x02U)
+#define TEST_PF4                      (0x10U)
+
+/* Errors reported by a rejected call: port_test is also built without the development error detection */
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+#define TEST_DET_ERROR                (1U)
+#else
+#define TEST_DET_ERROR                (0U)
+#endif
+
+/************************************************************************************
+ * Function Name: Test_peekPortF
+ * Parameters (in): Offset - Offset of the register
+ * Return value: uint32 - Value of the register of PORTF
+ * Description: Read a register of PORTF without any side effect.
+ ************************************************************************************/
+STATIC uint32 Test_peekPortF(uint32 Offset)
+{
+	return RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, Offset));
+}
+
+/************************************************************************************
+ * Function Name: Test_scrubPass
+ * Parameters (out): Counters - Counters of the scrubber after the pass
+ * Return value: None
+ * Description: Run the scrubber until it completes one pass over all the registers.
+ ************************************************************************************/
+STATIC void Test_scrubPass(Port_ScrubCountersType * Counters)
+{
+	uint32 passes;
+
+	Port_GetScrubCounters(Counters);
+	passes = Counters->Passes;
+	do
+	{
+		Port_ScrubRegisters();
+		Port_GetScrubCounters(Counters);
+	} while (Counters->Passes == passes);
+}
+
+/************************************************************************************
+ * Function Name: Test_SetPinsConfigNewOutput
+ * Description: A pin switched to output by Port_SetPinsConfig loses its pull resistor and
+ *              drives its initial value, a pin which is already an output keeps its level,
+ *              and the scrubber does not restore the pull resistor.
+ ************************************************************************************/
+STATIC void Test_SetPinsConfigNewOutput(void)
+{
+	STATIC const Port_PinConfigType pins[] =
+	{
+		{PORT_PIN_05, PORT_PIN_MODE_DIO, PORT_PIN_OUT},
+		{PORT_PIN_29, PORT_PIN_MODE_DIO, PORT_PIN_OUT}
+	};
+	Port_ScrubCountersType before;
+	Port_ScrubCountersType after;
+
+	Port_Init(&Port_Configuration);
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_PUR) & TEST_PF4, TEST_PF4);
+
+	/* Both data bits latched high: LED1 is driven on, SW1 is still an input */
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DATA_MASKED(TEST_PF1 | TEST_PF4))), 0xFFU);
+	Test_scrubPass(&before);
+
+	TEST_CHECK_EQUAL(Port_SetPinsConfig(pins, 2U), E_OK);
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_DIR) & (TEST_PF1 | TEST_PF4), TEST_PF1 | TEST_PF4);
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_PUR) & TEST_PF4, 0U);
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_PDR) & TEST_PF4, 0U);
+	TEST_CHECK_EQUAL(RegSim_GetPinLevel(TEST_PORTF, 4U), STD_LOW);
+	TEST_CHECK_EQUAL(RegSim_GetPinLevel(TEST_PORTF, 1U), STD_HIGH);
+
+	/* The expected images of the scrubber follow the cleared pull resistor */
+	Test_scrubPass(&after);
+	TEST_CHECK_EQUAL(after.Drifts[TEST_PORTF][PORT_SCRUB_PUR], before.Drifts[TEST_PORTF][PORT_SCRUB_PUR]);
+	TEST_CHECK_EQUAL(after.Drifts[TEST_PORTF][PORT_SCRUB_PDR], before.Drifts[TEST_PORTF][PORT_SCRUB_PDR]);
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_PUR) & TEST_PF4, 0U);
+}
+
+/************************************************************************************
+ * Function Name: Test_ScrubRestoresDrift
+ * Description: A pass of the scrubber restores the drifted GPIODEN and GPIOPCTL bits of LED1 (PF1)
+ *              and counts one drift of each register, the incremental scrubber checks at most
+ *              PORT_SCRUB_SLICE_REGISTERS registers per call.
+ ************************************************************************************/
+STATIC void Test_ScrubRestoresDrift(void)
+{
+	Port_ScrubCountersType before;
+	Port_ScrubCountersType after;
+	RegSim_StatsType stats;
+	uint32 den;
+	uint32 pctl;
+	uint8 port;
+	uint8 reg;
+
+	Port_Init(&Port_Configuration);
+	Test_scrubPass(&before);
+	den = Test_peekPortF(TEST_GPIO_DEN);
+	pctl = Test_peekPortF(TEST_GPIO_PCTL);
+
+	/* LED1 loses its digital function and gets the U1RTS function (PMC 1) */
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DEN)), den & ~(uint32)TEST_PF1);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_PCTL)), (pctl & ~0xF0UL) | 0x10UL);
+
+	RegSim_ClearStats();
+	Port_ScrubRegisters();
+	RegSim_GetStats(&stats);
+#if (PORT_SCRUB_INCREMENTAL == STD_ON)
+	TEST_CHECK(stats.Reads <= PORT_SCRUB_SLICE_REGISTERS);
+#else
+	/* one write per drifted register */
+	TEST_CHECK_EQUAL(stats.Writes, 2U);
+#endif
+	Test_scrubPass(&after);
+
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_DEN), den);
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_PCTL), pctl);
+	for (port = 0U; port < PORT_NUMBER_OF_PORTS; port++)
+	{
+		for (reg = 0U; reg < PORT_SCRUB_REGISTERS; reg++)
+		{
+			TEST_CHECK_EQUAL(after.Drifts[port][reg], before.Drifts[port][reg] +
+					(((TEST_PORTF == port) && ((PORT_SCRUB_DEN == reg) || (PORT_SCRUB_PCTL == reg))) ? 1U : 0U));
+		}
+	}
+}
+
+/************************************************************************************
+ * Function Name: Test_powerStateErrors
+ * Parameters (in): ApiId - Service ID
+ * Return value: uint16 - Number of the PORT_E_POWER_STATE errors reported by the service
+ * Description: Count the PORT_E_POWER_STATE errors of a service.
+ ************************************************************************************/
+STATIC uint16 Test_powerStateErrors(uint8 ApiId)
+{
+	return Det_GetErrorCount(PORT_MODULE_ID, ApiId, PORT_E_POWER_STATE);
+}
+
+/************************************************************************************
+ * Function Name: Test_LowPowerRejectsChanges
+ * Description: While the pins are parked, the services which write the pins configuration are
+ *              rejected: no access to the gated ports, one PORT_E_POWER_STATE error per call
+ *              with the development error detection,
+ *              and Port_ExitLowPower restores the configuration of the active profile.
+ ************************************************************************************/
+STATIC void Test_LowPowerRejectsChanges(void)
+{
+	STATIC const Port_PinConfigType pins[] =
+	{
+		{PORT_PIN_06, PORT_PIN_MODE_ADC, PORT_PIN_IN}
+	};
+	RegSim_StatsType stats;
+	uint16 switchErrors = Test_powerStateErrors(PORT_SWITCH_PROFILE_SID);
+	uint16 directionErrors = Test_powerStateErrors(PORT_SET_PIN_DIRECTION_SID);
+	uint16 modeErrors = Test_powerStateErrors(PORT_SET_PIN_MODE_SID);
+	uint16 configErrors = Test_powerStateErrors(PORT_SET_PINS_CONFIG_SID);
+
+	Port_Init(&Port_Configuration);
+	Port_EnterLowPower();
+
+	RegSim_ClearStats();
+	Port_SwitchProfile(PORT_PROFILE_DIAGNOSTIC);
+	Port_SetPinDirection(PORT_PIN_29, PORT_PIN_IN);
+	Port_SetPinMode(PORT_PIN_29, 1U);
+	TEST_CHECK_EQUAL(Port_SetPinsConfig(pins, 1U), E_NOT_OK);
+	RegSim_GetStats(&stats);
+	TEST_CHECK_EQUAL(stats.Faults, 0U);
+	TEST_CHECK_EQUAL(stats.Reads + stats.Writes, 0U);
+	TEST_CHECK_EQUAL(Test_powerStateErrors(PORT_SWITCH_PROFILE_SID), switchErrors + TEST_DET_ERROR);
+	TEST_CHECK_EQUAL(Test_powerStateErrors(PORT_SET_PIN_DIRECTION_SID), directionErrors + TEST_DET_ERROR);
+	TEST_CHECK_EQUAL(Test_powerStateErrors(PORT_SET_PIN_MODE_SID), modeErrors + TEST_DET_ERROR);
+	TEST_CHECK_EQUAL(Test_powerStateErrors(PORT_SET_PINS_CONFIG_SID), configErrors + TEST_DET_ERROR);
+
+	/* The RUN profile and LED1 are restored as they were parked */
+	Port_ExitLowPower();
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTE, TEST_GPIO_AMSEL)) & 0x0CU, 0U);
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_DIR) & TEST_PF1, TEST_PF1);
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_PCTL) & 0xF0U, 0U);
+
+	/* The profile did not change: the switch to DIAGNOSTIC applies its delta now */
+	Port_SwitchProfile(PORT_PROFILE_DIAGNOSTIC);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTE, TEST_GPIO_AMSEL)) & 0x0CU, 0x0CU);
+	Port_SwitchProfile(PORT_PROFILE_RUN);
+}
+
+/************************************************************************************
+ * Function Name: Test_LowPowerTwice
+ * Description: A second Port_EnterLowPower does not access the gated ports nor overwrite the
+ *              saved registers, and a second Port_ExitLowPower does nothing, with or without
+ *              the development error detection.
+ ************************************************************************************/
+STATIC void Test_LowPowerTwice(void)
+{
+	RegSim_StatsType stats;
+	uint32 den;
+	uint16 enterErrors = Test_powerStateErrors(PORT_ENTER_LOW_POWER_SID);
+	uint16 exitErrors = Test_powerStateErrors(PORT_EXIT_LOW_POWER_SID);
+
+	Port_Init(&Port_Configuration);
+	den = RegSim_Peek32(TEST_GPIO_REG(TEST_PORTA, TEST_GPIO_DEN));
+	TEST_CHECK(den != 0U);
+	Port_EnterLowPower();
+
+	RegSim_ClearStats();
+	Port_EnterLowPower();
+	RegSim_GetStats(&stats);
+	TEST_CHECK_EQUAL(stats.Faults, 0U);
+	TEST_CHECK_EQUAL(stats.Reads + stats.Writes, 0U);
+	TEST_CHECK_EQUAL(Test_powerStateErrors(PORT_ENTER_LOW_POWER_SID), enterErrors + TEST_DET_ERROR);
+
+	/* The registers saved by the first call are restored */
+	Port_ExitLowPower();
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTA, TEST_GPIO_DEN)), den);
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_DIR) & TEST_PF1, TEST_PF1);
+
+	RegSim_ClearStats();
+	Port_ExitLowPower();
+	RegSim_GetStats(&stats);
+	TEST_CHECK_EQUAL(stats.Reads + stats.Writes, 0U);
+	TEST_CHECK_EQUAL(Test_powerStateErrors(PORT_EXIT_LOW_POWER_SID), exitErrors + TEST_DET_ERROR);
+}
+
+/************************************************************************************
+ * Function Name: Test_pctlMask
+ * Parameters (in): Pins - Pins of a port
+ * Return value: uint32 - Bits of the PMCx fields of the pins
+ * Description: Mask of the GPIOPCTL fields of a set of pins.
+ ************************************************************************************/
+STATIC uint32 Test_pctlMask(uint8 Pins)
+{
+	uint32 mask = 0U;
+	uint8 pin;
+
+	for (pin = 0U; pin < 8U; pin++)
+	{
+		if ((Pins & (1U << pin)) != 0U)
+		{
+			mask |= 0xFUL << (pin * 4U);
+		}
+	}
+	return mask;
+}
+
+/************************************************************************************
+ * Function Name: Test_checkProfile
+ * Parameters (in): Profile - Profile which shall be applied
+ *                  Overridden - Pins of every port overridden by any profile
+ * Return value: None
+ * Description: Compare the live registers of the overridden pins with the images of a profile.
+ ************************************************************************************/
+STATIC void Test_checkProfile(Port_ProfileType Profile, const uint8 * Overridden)
+{
+	const Port_PortImageType * image;
+	uint8 pins;
+	uint8 port;
+
+	for (port = 0U; port < PORT_NUMBER_OF_PORTS; port++)
+	{
+		image = &Port_Configuration.Profiles[Profile].Images[port];
+		pins = Overridden[port];
+		TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(port, TEST_GPIO_DIR)) & pins, image->Dir & pins);
+		TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(port, TEST_GPIO_PUR)) & pins, image->Pur & pins);
+		TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(port, TEST_GPIO_PDR)) & pins, image->Pdr & pins);
+		TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(port, TEST_GPIO_DEN)) & pins, image->Den & pins);
+		TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(port, TEST_GPIO_AFSEL)) & pins, image->Afsel & pins);
+		TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(port, TEST_GPIO_AMSEL)) & pins, image->Amsel & pins);
+		TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(port, TEST_GPIO_PCTL)) & Test_pctlMask(pins),
+				image->Pctl & Test_pctlMask(pins));
+	}
+}
+
+/************************************************************************************
+ * Function Name: Test_SwitchProfileSweep
+ * Description: Every switch From -> To leaves the registers of the pins overridden by any
+ *              profile as the image of the profile To.
+ ************************************************************************************/
+STATIC void Test_SwitchProfileSweep(void)
+{
+	uint8 overridden[PORT_NUMBER_OF_PORTS];
+	Port_ProfileType from;
+	Port_ProfileType to;
+	uint32 failures;
+	uint8 port;
+
+	for (port = 0U; port < PORT_NUMBER_OF_PORTS; port++)
+	{
+		overridden[port] = 0U;
+		for (from = 0U; from < PORT_NUMBER_OF_PROFILES; from++)
+		{
+			for (to = 0U; to < PORT_NUMBER_OF_PROFILES; to++)
+			{
+				overridden[port] |= Port_Configuration.Deltas[from][to].Images[port].Pins;
+			}
+		}
+	}
+	TEST_CHECK(overridden[TEST_PORTE] != 0U);
+	TEST_CHECK(overridden[TEST_PORTF] != 0U);
+
+	for (from = 0U; from < PORT_NUMBER_OF_PROFILES; from++)
+	{
+		for (to = 0U; to < PORT_NUMBER_OF_PROFILES; to++)
+		{
+			/* Port_Init configures the pins from the reset state of the registers */
+			failures = Test_Failures;
+			RegSim_Reset();
+			Port_Init(&Port_Configuration);
+			Port_SwitchProfile(from);
+			Test_checkProfile(from, overridden);
+			Port_SwitchProfile(to);
+			Test_checkProfile(to, overridden);
+			if (Test_Failures != failures)
+			{
+				printf("switch from profile %u to profile %u\n", (unsigned int)from, (unsigned int)to);
+			}
+		}
+	}
+}
+
+/************************************************************************************
+ * Function Name: Test_pctlIsr
+ * Description: Simulated interrupt which selects T1CCP0 (PMC 7) on PF2 with a plain
+ *              read-modify-write of GPIOPCTL.
+ ************************************************************************************/
+STATIC void Test_pctlIsr(void)
+{
+	volatile uint32 * pctl = TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_PCTL));
+
+	REG_WRITE32(pctl, (REG_READ32(pctl) & ~0x00000F00UL) | 0x00000700UL);
+}
+
+/************************************************************************************
+ * Function Name: Test_SetPinModePreempted
+ * Description: An interrupt which writes GPIOPCTL between the exclusive read and the exclusive
+ *              write of Port_SetPinMode fails the write, the update is retried and both PMCx
+ *              fields survive.
+ ************************************************************************************/
+STATIC void Test_SetPinModePreempted(void)
+{
+	RegSim_StatsType alone;
+	RegSim_StatsType preempted;
+
+	Port_Init(&Port_Configuration);
+
+	/* Reference accesses of the call without any interrupt */
+	RegSim_ClearStats();
+	Port_SetPinMode(PORT_PIN_29, 1U);
+	RegSim_GetStats(&alone);
+	Port_SetPinMode(PORT_PIN_29, PORT_PIN_MODE_DIO);
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_PCTL) & 0xFF0U, 0U);
+
+	RegSim_ClearStats();
+	RegSim_SetPreemptHook(Test_pctlIsr);
+	Port_SetPinMode(PORT_PIN_29, 1U);
+	RegSim_GetStats(&preempted);
+	TEST_CHECK_EQUAL(Test_peekPortF(TEST_GPIO_PCTL) & 0xFF0U, 0x710U);
+
+	/* The interrupt read and wrote GPIOPCTL once, the driver read it once more for the retry */
+	TEST_CHECK_EQUAL(preempted.Reads, alone.Reads + 2U);
+	TEST_CHECK_EQUAL(preempted.Writes, alone.Writes + 1U);
+}
+
+STATIC const Test_CaseType Test_Cases[] =
+{
+	{"Port_SetPinsConfig new output",   Test_SetPinsConfigNewOutput},
+	{"scrubber restores the drift",     Test_ScrubRestoresDrift},
+	{"low power rejects the changes",   Test_LowPowerRejectsChanges},
+	{"low power entered twice",         Test_LowPowerTwice},
+	{"Port_SetPinMode preempted",       Test_SetPinModePreempted},
+	{"Port_SwitchProfile all switches", Test_SwitchProfileSweep},
+};
+
+int main(void)
+{
+	return TEST_RUN(Test_Cases);
+}
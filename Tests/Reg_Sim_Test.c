@@ -0,0 +1,226 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Reg_Sim_Test.c
+ *
+ * Description: Host test of the simulated GPIO registers and of the driver accesses to them:
+ *              masked GPIODATA writes, the GPIOLOCK/GPIOCR commit and the clock gating.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#include "Test_Check.h"
+#include "Port.h"
+#include "Dio.h"
+
+/************************************************************************************
+ * Function Name: Test_enablePort
+ * Parameters (in): PortIndex - Port to be clocked
+ * Return value: None
+ * Description: Enable the clock of a GPIO port as Port_Init does.
+ ************************************************************************************/
+STATIC void Test_enablePort(uint8 PortIndex)
+{
+	REG_SET_BIT(TEST_REG(TEST_SYSCTL_RCGC2), PortIndex);
+}
+
+/************************************************************************************
+ * Function Name: Test_MaskedDataWrite
+ * Description: A GPIODATA access through the address mask touches only the selected pins.
+ ************************************************************************************/
+STATIC void Test_MaskedDataWrite(void)
+{
+	Test_enablePort(TEST_PORTF);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DEN)), 0x0EU);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DIR)), 0x0EU);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DATA)), 0x0AU);
+
+	/* Set PF2 and clear PF1 with all the data bits written */
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DATA_MASKED(0x04U))), 0xFFU);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DATA)), 0x0EU);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DATA_MASKED(0x02U))), 0x00U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DATA)), 0x0CU);
+
+	/* A masked read returns the selected pins only */
+	TEST_CHECK_EQUAL(REG_READ32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DATA_MASKED(0x08U)))), 0x08U);
+	TEST_CHECK_EQUAL(REG_READ32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DATA_MASKED(0x02U)))), 0x00U);
+}
+
+/************************************************************************************
+ * Function Name: Test_DioWriteChannelMasked
+ * Description: Dio_WriteChannel changes its own pin with one write and keeps the other
+ *              pins of the port.
+ ************************************************************************************/
+STATIC void Test_DioWriteChannelMasked(void)
+{
+	RegSim_StatsType stats;
+
+	Port_Init(&Port_Configuration);
+	Dio_Init(&Dio_Configuration);
+
+	/* Drive PF2 and PF3 (blue and green leds) high behind the driver */
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DATA_MASKED(0x0CU))), 0x0CU);
+
+	RegSim_ClearStats();
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+	RegSim_GetStats(&stats);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DATA)) & 0x0EU, 0x0EU);
+	TEST_CHECK_EQUAL(stats.Writes, 1U);
+
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DATA)) & 0x0EU, 0x0CU);
+}
+
+/************************************************************************************
+ * Function Name: Test_LockCommit
+ * Description: The locked pins (PF0, PD7 and the JTAG pins PC0-3) keep their AFSEL, PUR, PDR and
+ *              DEN bits until GPIOLOCK is unlocked and their GPIOCR bit is committed.
+ ************************************************************************************/
+STATIC void Test_LockCommit(void)
+{
+	Test_enablePort(TEST_PORTF);
+	Test_enablePort(TEST_PORTC);
+
+	/* Locked: the writes of the PF0 bit are ignored, the other pins are written */
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_PUR)), 0x11U);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DEN)), 0x11U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_PUR)), 0x10U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DEN)), 0x10U);
+
+	/* GPIOCR is read-only while GPIOLOCK is locked */
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_CR)), 0x01U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_CR)) & 0x01U, 0x00U);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_PUR)), 0x11U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_PUR)), 0x10U);
+
+	/* Unlocked and committed: PF0 is written */
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_LOCK)), TEST_GPIO_UNLOCK_VALUE);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_CR)), 0x01U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_CR)) & 0x01U, 0x01U);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_PUR)), 0x11U);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DEN)), 0x11U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_PUR)), 0x11U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DEN)), 0x11U);
+
+	/* The JTAG pins keep their reset configuration */
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTC, TEST_GPIO_AFSEL)), 0x00U);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTC, TEST_GPIO_DEN)), 0x00U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTC, TEST_GPIO_AFSEL)), 0x0FU);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTC, TEST_GPIO_DEN)), 0x0FU);
+}
+
+/************************************************************************************
+ * Function Name: Test_PortInitCommit
+ * Description: Port_Init commits PF0 (SW2, digital input) and keeps the JTAG pins.
+ ************************************************************************************/
+STATIC void Test_PortInitCommit(void)
+{
+	Port_Init(&Port_Configuration);
+
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DEN)) & 0x01U, 0x01U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DIR)) & 0x01U, 0x00U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTC, TEST_GPIO_AFSEL)) & 0x0FU, 0x0FU);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTC, TEST_GPIO_PCTL)) & 0xFFFFU, 0x1111U);
+}
+
+/************************************************************************************
+ * Function Name: Test_GatedPortFaults
+ * Description: An access to a port with its clock gated faults and a write is dropped.
+ ************************************************************************************/
+STATIC void Test_GatedPortFaults(void)
+{
+	RegSim_StatsType stats;
+
+	RegSim_ClearStats();
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTA, TEST_GPIO_DIR)), 0xFFU);
+	RegSim_GetStats(&stats);
+	TEST_CHECK_EQUAL(stats.Faults, 1U);
+
+	(void)REG_READ32(TEST_REG(TEST_GPIO_REG(TEST_PORTA, TEST_GPIO_DIR)));
+	RegSim_GetStats(&stats);
+	TEST_CHECK_EQUAL(stats.Faults, 2U);
+
+	/* Clocked again, the dropped write is not there */
+	Test_enablePort(TEST_PORTA);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTA, TEST_GPIO_DIR)), 0x00U);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTA, TEST_GPIO_DIR)), 0xFFU);
+	RegSim_GetStats(&stats);
+	TEST_CHECK_EQUAL(stats.Faults, 2U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTA, TEST_GPIO_DIR)), 0xFFU);
+}
+
+/************************************************************************************
+ * Function Name: Test_PortInitNoFaults
+ * Description: Port_Init clocks every port before it configures it.
+ ************************************************************************************/
+STATIC void Test_PortInitNoFaults(void)
+{
+	RegSim_StatsType stats;
+
+	RegSim_ClearStats();
+	Port_Init(&Port_Configuration);
+	RegSim_GetStats(&stats);
+	TEST_CHECK_EQUAL(stats.Faults, 0U);
+}
+
+/************************************************************************************
+ * Function Name: Test_dirIsr
+ * Description: Simulated interrupt which writes GPIODIR of PORTF.
+ ************************************************************************************/
+STATIC void Test_dirIsr(void)
+{
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DIR)), 0x08U);
+}
+
+/************************************************************************************
+ * Function Name: Test_ExclusiveMonitor
+ * Description: An exclusive write succeeds only after an exclusive read of the same register
+ *              with no write in between, an interrupt between them fails it.
+ ************************************************************************************/
+STATIC void Test_ExclusiveMonitor(void)
+{
+	volatile uint32 * dir = TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DIR));
+
+	Test_enablePort(TEST_PORTF);
+
+	(void)RegSim_ReadExclusive32(dir);
+	TEST_CHECK_EQUAL(RegSim_WriteExclusive32(dir, 0x02U), 0U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DIR)), 0x02U);
+
+	/* The monitor is closed by the successful write */
+	TEST_CHECK_EQUAL(RegSim_WriteExclusive32(dir, 0x04U), 1U);
+
+	/* A write in between closes it */
+	(void)RegSim_ReadExclusive32(dir);
+	REG_WRITE32(TEST_REG(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DEN)), 0x02U);
+	TEST_CHECK_EQUAL(RegSim_WriteExclusive32(dir, 0x04U), 1U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DIR)), 0x02U);
+
+	/* An interrupt between the exclusive read and write, the interrupt value is kept */
+	(void)RegSim_ReadExclusive32(dir);
+	RegSim_SetPreemptHook(Test_dirIsr);
+	TEST_CHECK_EQUAL(RegSim_WriteExclusive32(dir, 0x04U), 1U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DIR)), 0x08U);
+
+	/* The hook runs once */
+	(void)RegSim_ReadExclusive32(dir);
+	TEST_CHECK_EQUAL(RegSim_WriteExclusive32(dir, 0x0CU), 0U);
+	TEST_CHECK_EQUAL(RegSim_Peek32(TEST_GPIO_REG(TEST_PORTF, TEST_GPIO_DIR)), 0x0CU);
+}
+
+STATIC const Test_CaseType Test_Cases[] =
+{
+	{"masked GPIODATA write",           Test_MaskedDataWrite},
+	{"Dio_WriteChannel masked write",   Test_DioWriteChannelMasked},
+	{"GPIOLOCK/GPIOCR commit",          Test_LockCommit},
+	{"Port_Init commit of PF0",         Test_PortInitCommit},
+	{"gated port access faults",        Test_GatedPortFaults},
+	{"Port_Init without faults",        Test_PortInitNoFaults},
+	{"exclusive monitor",               Test_ExclusiveMonitor},
+};
+
+int main(void)
+{
+	return TEST_RUN(Test_Cases);
+}
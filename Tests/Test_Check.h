@@ -0,0 +1,87 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Test_Check.h
+ *
+ * Description: Checks of the host tests. Every test case starts from the power-on reset state
+ *              of the simulated registers, a failed check prints its location and its values
+ *              and the test exits with 1.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <stdio.h>
+
+#include "Test_Sim.h"
+
+/*******************************************************************************
+ *                                  Checks                                     *
+ *******************************************************************************/
+/* Number of the failed checks of the current test case */
+STATIC uint32 Test_Failures = 0U;
+
+/* Check a condition */
+#define TEST_CHECK(COND) \
+	do { \
+		if (!(COND)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND); \
+			Test_Failures++; \
+		} \
+	} while (0)
+
+/* Check a 32-bit value */
+#define TEST_CHECK_EQUAL(ACTUAL,EXPECTED) \
+	do { \
+		uint32 test_actual_ = (uint32)(ACTUAL); \
+		uint32 test_expected_ = (uint32)(EXPECTED); \
+		if (test_actual_ != test_expected_) \
+		{ \
+			printf("%s:%d: %s = 0x%08lX, expected 0x%08lX\n", __FILE__, __LINE__, #ACTUAL, \
+					(unsigned long)test_actual_, (unsigned long)test_expected_); \
+			Test_Failures++; \
+		} \
+	} while (0)
+
+/* Test case */
+typedef void (*Test_FunctionType)(void);
+
+typedef struct
+{
+	const char * Name;
+	Test_FunctionType Function;
+} Test_CaseType;
+
+/************************************************************************************
+ * Function Name: Test_Run
+ * Parameters (in): Cases - Test cases
+ *                  Count - Number of the test cases
+ * Return value: int - Exit status of the test: 0 if all the test cases passed, 1 otherwise
+ * Description: Run every test case from the reset state of the simulated registers and
+ *              print its result.
+ ************************************************************************************/
+STATIC int Test_Run(const Test_CaseType * Cases, uint32 Count)
+{
+	uint32 index;
+	uint32 failed = 0U;
+
+	for (index = 0U; index < Count; index++)
+	{
+		Test_Failures = 0U;
+		RegSim_Reset();
+		Cases[index].Function();
+		printf("%-48s %s\n", Cases[index].Name, (0U == Test_Failures) ? "PASS" : "FAIL");
+		failed += (0U == Test_Failures) ? 0U : 1U;
+	}
+	printf("%lu / %lu test cases passed\n", (unsigned long)(Count - failed), (unsigned long)Count);
+	return (0U == failed) ? 0 : 1;
+}
+
+/* Run the test cases of an array */
+#define TEST_RUN(CASES)   Test_Run((CASES), (uint32)(sizeof(CASES) / sizeof((CASES)[0])))
+
+#endif /* TEST_CHECK_H */
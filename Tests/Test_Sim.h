@@ -0,0 +1,59 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Test_Sim.h
+ *
+ * Description: Addresses of the simulated GPIO registers used by the host tests.
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#ifndef TEST_SIM_H
+#define TEST_SIM_H
+
+#include <stdint.h>
+
+#include "Std_Types.h"
+#include "Reg_Access.h"
+#include "Reg_Sim.h"
+
+/*******************************************************************************
+ *                         Simulated Registers                                 *
+ *******************************************************************************/
+/* APB base address of a GPIO port (PORTA = 0 ... PORTF = 5) */
+#define TEST_GPIO_BASE(PORT)          (((PORT) < 4U) ? (0x40004000UL + ((uint32)(PORT) << 12U)) :\
+                                                       (0x40024000UL + ((uint32)((PORT) - 4U) << 12U)))
+
+/* Offsets of the GPIO registers */
+#define TEST_GPIO_DATA                (0x3FCUL)
+#define TEST_GPIO_DIR                 (0x400UL)
+#define TEST_GPIO_AFSEL               (0x420UL)
+#define TEST_GPIO_PUR                 (0x510UL)
+#define TEST_GPIO_PDR                 (0x514UL)
+#define TEST_GPIO_DEN                 (0x51CUL)
+#define TEST_GPIO_LOCK                (0x520UL)
+#define TEST_GPIO_CR                  (0x524UL)
+#define TEST_GPIO_AMSEL               (0x528UL)
+#define TEST_GPIO_PCTL                (0x52CUL)
+
+/* Data alias of a GPIO port which selects the pins of MASK (address bits [9:2]) */
+#define TEST_GPIO_DATA_MASKED(MASK)   ((uint32)(MASK) << 2U)
+
+/* Value of GPIOLOCK which unlocks GPIOCR */
+#define TEST_GPIO_UNLOCK_VALUE        (0x4C4F434BUL)
+
+/* Clock gating of the GPIO ports */
+#define TEST_SYSCTL_RCGC2             (0x400FE108UL)
+
+/* Physical address of a GPIO register and the register pointer of an address, as the drivers use it */
+#define TEST_GPIO_REG(PORT,OFFSET)    (TEST_GPIO_BASE(PORT) + (OFFSET))
+#define TEST_REG(ADDRESS)             REG_ADDRESS_TO_POINTER(ADDRESS)
+
+/* Ports of the tests */
+#define TEST_PORTA                    (0U)
+#define TEST_PORTC                    (2U)
+#define TEST_PORTE                    (4U)
+#define TEST_PORTF                    (5U)
+
+#endif /* TEST_SIM_H */
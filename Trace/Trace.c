@@ -0,0 +1,73 @@
+ /******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace.c
+ *
+ * Description: Source file for the Trace module
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#include "Trace.h"
+#include "Reg_Access.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if ((TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1U)) != 0U)
+#error "TRACE_BUFFER_SIZE shall be a power of 2"
+#endif
+
+/* Trace log, kept in RAM to be dumped by the debugger */
+Trace_LogType Trace_Log = {TRACE_MAGIC, TRACE_BUFFER_SIZE, 0U, {{0U, 0U, 0U, 0U, 0U}}};
+
+/************************************************************************************
+* Service Name: Trace_Record
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ModuleId - Module Id of the calling driver
+*                  ApiId - Service Id of the traced call
+*                  Channel - Channel, pin, port or group of the call
+*                  Value - Level, direction or mode written, or value read
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to record a service call of a driver in the next record of the
+*              ring buffer, overwriting the oldest record when the buffer is full.
+************************************************************************************/
+void Trace_Record(uint16 ModuleId, uint8 ApiId, uint8 Channel, uint32 Value)
+{
+	Trace_RecordType * record;
+	uint32 state = 0U;
+
+	/* the drivers are called from the tasks and from the interrupts: reserve and write the record at once */
+	INTERRUPTS_SAVE_DISABLE(state);
+
+	record = &Trace_Log.Records[Trace_Log.Count & (TRACE_BUFFER_SIZE - 1U)];
+	record->Timestamp = TRACE_TIMESTAMP();
+	record->ModuleId  = ModuleId;
+	record->ApiId     = ApiId;
+	record->Channel   = Channel;
+	record->Value     = Value;
+	Trace_Log.Count++;
+
+	INTERRUPTS_RESTORE(state);
+}
+
+/************************************************************************************
+* Service Name: Trace_Clear
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to discard all the records of the trace log.
+************************************************************************************/
+void Trace_Clear(void)
+{
+	uint32 state = 0U;
+
+	INTERRUPTS_SAVE_DISABLE(state);
+	Trace_Log.Count = 0U;
+	INTERRUPTS_RESTORE(state);
+}
@@ -0,0 +1,76 @@
+ /******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace.h
+ *
+ * Description: Header file for the Trace module, it records the service calls of the
+ *              drivers into a RAM ring buffer which is read back with a debugger memory
+ *              dump and decoded on the host by trace_decode (Not exist in AUTOSAR).
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+/* Id for the company in the AUTOSAR, here is No company just example */
+#define TRACE_VENDOR_ID    (1000U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define TRACE_SW_MAJOR_VERSION           (1U)
+#define TRACE_SW_MINOR_VERSION           (0U)
+#define TRACE_SW_PATCH_VERSION           (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* Trace Pre-Compile Configuration Header file */
+#include "Trace_Cfg.h"
+
+/* First word of the trace log, used by the decoder to check a memory dump ("TRCE") */
+#define TRACE_MAGIC                      (0x54524345UL)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* One service call of a driver (12 bytes, no padding) */
+typedef struct
+{
+	uint32 Timestamp;   /* TRACE_TIMESTAMP() at the call */
+	uint16 ModuleId;    /* Module Id of the driver */
+	uint8 ApiId;        /* Service Id of the call (the *_SID of the driver) */
+	uint8 Channel;      /* Channel, pin, port or group of the call */
+	uint32 Value;       /* Level, direction or mode written, or value read */
+} Trace_RecordType;
+
+/* Trace log to be dumped from the RAM as a whole: &Trace_Log, sizeof(Trace_LogType) bytes */
+typedef struct
+{
+	uint32 Magic;       /* TRACE_MAGIC */
+	uint32 Size;        /* Number of the records of the ring buffer */
+	uint32 Count;       /* Number of the recorded calls, the next record is Records[Count % Size] */
+	Trace_RecordType Records[TRACE_BUFFER_SIZE];
+} Trace_LogType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function to record a service call of a driver */
+void Trace_Record(uint16 ModuleId, uint8 ApiId, uint8 Channel, uint32 Value);
+
+/* Function to discard all the records */
+void Trace_Clear(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Trace log, read by the debugger */
+extern Trace_LogType Trace_Log;
+
+#endif /* TRACE_H */
@@ -0,0 +1,24 @@
+ /******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for the Trace module
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#ifndef TRACE_CFG_H
+#define TRACE_CFG_H
+
+/* Number of the records of the ring buffer (power of 2), the oldest records are overwritten */
+#define TRACE_BUFFER_SIZE                   (64U)
+
+/*
+ * Time stamp of the records: the SysTick current value (24-bit down counter) by default, the DWT
+ * cycle counter (0xE0001004, once enabled by the application) may be used for a 32-bit up counter
+ */
+#define TRACE_TIMESTAMP()                   REG_READ32(&SYSTICK_CURRENT_REG)
+
+#endif /* TRACE_CFG_H */
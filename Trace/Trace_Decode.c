@@ -0,0 +1,159 @@
+ /******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace_Decode.c
+ *
+ * Description: Host tool to decode a memory dump of Trace_Log (little endian, as saved
+ *              by the debugger from &Trace_Log) into the service calls of the drivers,
+ *              from the oldest record to the newest one.
+ *              Usage: trace_decode <dump file>
+ *
+ * Author: Toka Zakaria
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "Port.h"
+#include "Dio.h"
+#include "Trace.h"
+
+/* Size of the header (Magic, Size, Count) and of one record in the dump */
+#define TRACE_DECODE_HEADER_SIZE     (12U)
+#define TRACE_DECODE_RECORD_SIZE     (12U)
+
+/* Largest ring buffer accepted from a dump */
+#define TRACE_DECODE_MAX_RECORDS     (4096U)
+
+/* Name of a traced service */
+typedef struct
+{
+	uint16 ModuleId;
+	uint8 ApiId;
+	const char * Name;
+} TraceDecode_ServiceType;
+
+STATIC const TraceDecode_ServiceType TraceDecode_Services[] =
+{
+	{PORT_MODULE_ID, PORT_INIT_SID,                   "Port_Init"},
+	{PORT_MODULE_ID, PORT_SET_PIN_DIRECTION_SID,      "Port_SetPinDirection"},
+	{PORT_MODULE_ID, PORT_REFRESH_PORT_DIRECTION_SID, "Port_RefreshPortDirection"},
+	{PORT_MODULE_ID, PORT_GET_VERSION_INFO_SID,       "Port_GetVersionInfo"},
+	{PORT_MODULE_ID, PORT_SET_PIN_MODE_SID,           "Port_SetPinMode"},
+	{PORT_MODULE_ID, PORT_SCRUB_REGISTERS_SID,        "Port_ScrubRegisters"},
+	{PORT_MODULE_ID, PORT_GET_SCRUB_COUNTERS_SID,     "Port_GetScrubCounters"},
+	{PORT_MODULE_ID, PORT_SET_PINS_CONFIG_SID,        "Port_SetPinsConfig"},
+	{PORT_MODULE_ID, PORT_SWITCH_PROFILE_SID,         "Port_SwitchProfile"},
+	{PORT_MODULE_ID, PORT_ENTER_LOW_POWER_SID,        "Port_EnterLowPower"},
+	{PORT_MODULE_ID, PORT_EXIT_LOW_POWER_SID,         "Port_ExitLowPower"},
+	{DIO_MODULE_ID,  DIO_READ_CHANNEL_SID,            "Dio_ReadChannel"},
+	{DIO_MODULE_ID,  DIO_WRITE_CHANNEL_SID,           "Dio_WriteChannel"},
+	{DIO_MODULE_ID,  DIO_READ_PORT_SID,               "Dio_ReadPort"},
+	{DIO_MODULE_ID,  DIO_WRITE_PORT_SID,              "Dio_WritePort"},
+	{DIO_MODULE_ID,  DIO_READ_CHANNEL_GROUP_SID,      "Dio_ReadChannelGroup"},
+	{DIO_MODULE_ID,  DIO_WRITE_CHANNEL_GROUP_SID,     "Dio_WriteChannelGroup"},
+	{DIO_MODULE_ID,  DIO_GET_VERSION_INFO_SID,        "Dio_GetVersionInfo"},
+	{DIO_MODULE_ID,  DIO_INIT_SID,                    "Dio_Init"},
+	{DIO_MODULE_ID,  DIO_FLIP_CHANNEL_SID,            "Dio_FlipChannel"},
+	{DIO_MODULE_ID,  DIO_GET_EDGE_EVENT_SID,          "Dio_GetEdgeEvent"},
+	{DIO_MODULE_ID,  DIO_GET_DEBOUNCED_LEVEL_SID,     "Dio_GetDebouncedLevel"},
+	{DIO_MODULE_ID,  DIO_GET_DEBOUNCE_EVENT_SID,      "Dio_GetDebounceEvent"},
+	{DIO_MODULE_ID,  DIO_SOFT_PWM_SET_DUTY_SID,       "Dio_SoftPwmSetDuty"},
+};
+
+/* Dump of the trace log */
+STATIC uint8 TraceDecode_Dump[TRACE_DECODE_HEADER_SIZE + (TRACE_DECODE_MAX_RECORDS * TRACE_DECODE_RECORD_SIZE)];
+
+/* Read a little endian 16-bit / 32-bit field of the dump */
+STATIC uint16 TraceDecode_Get16(const uint8 * Data)
+{
+	return (uint16)((uint16)Data[0] | ((uint16)Data[1] << 8U));
+}
+
+STATIC uint32 TraceDecode_Get32(const uint8 * Data)
+{
+	return (uint32)Data[0] | ((uint32)Data[1] << 8U) | ((uint32)Data[2] << 16U) | ((uint32)Data[3] << 24U);
+}
+
+/* Name of a traced service or NULL_PTR if it is unknown */
+STATIC const char * TraceDecode_Name(uint16 ModuleId, uint8 ApiId)
+{
+	const char * name = NULL_PTR;
+	uint32 index;
+
+	for (index = 0U; index < (sizeof(TraceDecode_Services) / sizeof(TraceDecode_Services[0])); index++)
+	{
+		if ((TraceDecode_Services[index].ModuleId == ModuleId) && (TraceDecode_Services[index].ApiId == ApiId))
+		{
+			name = TraceDecode_Services[index].Name;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	return name;
+}
+
+int main(int argc, char * argv[])
+{
+	FILE * file;
+	size_t length;
+	uint32 size;
+	uint32 count;
+	uint32 sequence;
+	const uint8 * record;
+	const char * name;
+
+	if (argc != 2)
+	{
+		fprintf(stderr, "usage: %s <Trace_Log dump>\n", argv[0]);
+		return 2;
+	}
+
+	file = fopen(argv[1], "rb");
+	if (NULL == file)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+	length = fread(TraceDecode_Dump, 1U, sizeof(TraceDecode_Dump), file);
+	(void)fclose(file);
+
+	if ((length < TRACE_DECODE_HEADER_SIZE) || (TraceDecode_Get32(&TraceDecode_Dump[0]) != TRACE_MAGIC))
+	{
+		fprintf(stderr, "%s: not a Trace_Log dump\n", argv[1]);
+		return 1;
+	}
+
+	size  = TraceDecode_Get32(&TraceDecode_Dump[4]);
+	count = TraceDecode_Get32(&TraceDecode_Dump[8]);
+	if ((0U == size) || (size > TRACE_DECODE_MAX_RECORDS) || ((size & (size - 1U)) != 0U) ||
+			(length < (TRACE_DECODE_HEADER_SIZE + ((size_t)size * TRACE_DECODE_RECORD_SIZE))))
+	{
+		fprintf(stderr, "%s: truncated dump or invalid buffer size %lu\n", argv[1], (unsigned long)size);
+		return 1;
+	}
+
+	printf("%lu calls recorded, %lu records kept\n", (unsigned long)count,
+			(unsigned long)((count < size) ? count : size));
+	printf("%10s %10s  %-26s %8s %10s\n", "sequence", "timestamp", "service", "channel", "value");
+
+	/* from the oldest kept record to the newest one */
+	for (sequence = (count < size) ? 0U : (count - size); sequence != count; sequence++)
+	{
+		record = &TraceDecode_Dump[TRACE_DECODE_HEADER_SIZE + ((sequence & (size - 1U)) * TRACE_DECODE_RECORD_SIZE)];
+		name = TraceDecode_Name(TraceDecode_Get16(&record[4]), record[6]);
+		if (NULL_PTR != name)
+		{
+			printf("%10lu %10lu  %-26s", (unsigned long)sequence, (unsigned long)TraceDecode_Get32(&record[0]), name);
+		}
+		else
+		{
+			printf("%10lu %10lu  Module %3u, Service 0x%02X  ", (unsigned long)sequence,
+					(unsigned long)TraceDecode_Get32(&record[0]), TraceDecode_Get16(&record[4]), record[6]);
+		}
+		printf(" %8u 0x%08lX\n", record[7], (unsigned long)TraceDecode_Get32(&record[8]));
+	}
+	return 0;
+}